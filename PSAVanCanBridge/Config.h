@@ -17,9 +17,16 @@ constexpr bool LOG_MSG_WITH_CRC_ERROR = true;
 
 constexpr bool READ_SERIAL_PORT_FOR_COMMANDS = false;
 
+// if true the reports (traffic, heartbeats, transmit queue, tasks, memory) are printed on the F, H, J, Q, P and R commands,
+// they only print so they are safe to leave on in the car while READ_SERIAL_PORT_FOR_COMMANDS is false
+constexpr bool READ_SERIAL_PORT_FOR_DIAGNOSTICS = true;
+
 constexpr uint8_t ENABLE_PARKING_AID_SOUND_FROM_SPEAKER = 0;
 
 constexpr uint8_t TASK_WATCHDOG_TIMEOUT = 7;
+
+// the memory report (static RAM, heap and task stacks) is logged this often in milliseconds, 0 turns it off
+constexpr uint32_t MEMORY_REPORT_LOG_INTERVAL = 60000;
 constexpr uint8_t FUEL_TANK_CAPACITY_IN_LITERS = 60;
 
 // 11: HW revision v1.1
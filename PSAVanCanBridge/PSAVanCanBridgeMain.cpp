@@ -35,6 +35,9 @@
 #include "src/Can/CanDataSenderTask.h"
 #include "src/Can/CanDataReaderTask.h"
 #include "src/Van/VanDataParserTask.h"
+#include "src/Van/VanFrameRing.h"
+#include "src/Van/VanReceiverTask.h"
+#include "src/Van/VanReaderTask.h"
 #include "src/Van/VanWriterTask.h"
 
 #if POPUP_HANDLER == 1
@@ -65,13 +68,25 @@
 #include "src/Helpers/VanDataToBridgeToCan.h"
 #include "src/Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "src/Helpers/VanVinToBridgeToCan.h"
+#include "src/Helpers/SharedSnapshot.h"
+#include "src/Helpers/SignalBus.h"
+#include "src/Helpers/BridgeEventQueue.h"
+#include "src/Can/CanBridgeEventDispatcher.h"
 #include "src/Helpers/IVinFlashStorage.h"
 #include "src/Helpers/IGetDeviceInfo.h"
+#include "src/Helpers/DiagnosticCommands.h"
 #include "src/Helpers/SerialReader.h"
 
 #include "src/Can/CanMessageHandlerContainer.h"
+#include "src/Can/CanHeartbeatScheduler.h"
+#include "src/Can/CanTransmitQueue.h"
+#include "src/Can/CanFrameSequencer.h"
+#include "src/Helpers/TaskProfiler.h"
+#include "src/Helpers/MemoryReport.h"
+#include "src/Helpers/StaticInstance.h"
 #include "src/Can/Handlers/CanNaviPositionHandler.h"
 #include "src/Van/VanHandlerContainer.h"
+#include "src/Van/VanTrafficStatistics.h"
 #include "src/Can/Handlers/ICanDisplayPopupHandler.h"
 #pragma endregion
 
@@ -95,17 +110,66 @@ const uint8_t VAN_DATA_RX_RMT_CHANNEL = 0;
 
 const uint8_t VAN_DATA_RX_LED_INDICATOR_PIN = 2;
 
-VanDataToBridgeToCan dataToBridge;
-VanIgnitionDataToBridgeToCan ignitionDataToBridge;
-VanVinToBridgeToCan vinDataToBridge;
+// the VAN read task sleeps until the receiver signals new frames, but wakes up at least this often to feed the watchdog
+const TickType_t VAN_READ_MAX_WAIT = 1000 / portTICK_PERIOD_MS;
 
+// the CAN transmit task sleeps until a message is queued, but wakes up at least this often to feed the watchdog
+const TickType_t CAN_TRANSMIT_MAX_WAIT = 100 / portTICK_PERIOD_MS;
+// while a frame sequence is running the CAN transmit task wakes up this often to send its next frame
+const TickType_t CAN_SEQUENCE_WAIT = 1 / portTICK_PERIOD_MS;
+
+// written by the VAN read task from its working copies
+SharedSnapshot<VanDataToBridgeToCan> dataToBridgeSnapshot;
+SharedSnapshot<VanIgnitionDataToBridgeToCan> ignitionDataToBridgeSnapshot;
+SharedSnapshot<VanVinToBridgeToCan> vinDataToBridgeSnapshot;
+
+// the copies the reader tasks work with during a cycle, one per task, kept here instead of on the task stacks
+SharedSnapshotView<VanDataToBridgeToCan> sendDataView(dataToBridgeSnapshot);
+SharedSnapshotView<VanIgnitionDataToBridgeToCan> sendIgnitionView(ignitionDataToBridgeSnapshot);
+SharedSnapshotView<VanVinToBridgeToCan> sendIgnitionVinView(vinDataToBridgeSnapshot);
+#if HW_VERSION == 14
+SharedSnapshotView<VanIgnitionDataToBridgeToCan> vanWriteView(ignitionDataToBridgeSnapshot);
+#endif
+
+// the values which moved from the structs above to single signals
+SignalBus signalBus;
+// one-shot actions for the CAN handlers, only the CAN data task applies them
+BridgeEventQueue bridgeEventQueue;
+
+// indexes of the tasks in taskProfiles
+enum TaskIndex {
+    TASK_CAN_TRANSMIT,
+    TASK_CAN_SEND_IGNITION,
+    TASK_CAN_SEND_DATA,
+    TASK_VAN_READ,
+    TASK_VAN_RECEIVE,
+    TASK_CAN_READ,
+#if HW_VERSION == 14
+    TASK_VAN_WRITE,
+#endif
+    TASK_COUNT
+};
+
+// the heartbeats of a handler are sent by the task which feeds it with data
+enum HeartbeatLane {
+    HEARTBEAT_LANE_DATA,
+    HEARTBEAT_LANE_IGNITION
+};
+
+TaskProfiler taskProfiler;
+MemoryReport memoryReport(&taskProfiler, MEMORY_REPORT_LOG_INTERVAL);
+
+TaskHandle_t CANTransmitTask;
 TaskHandle_t CANSendIgnitionTask;
 TaskHandle_t CANSendDataTask;
 
+TaskHandle_t VANReceiveTask;
 TaskHandle_t VANReadTask;
 TaskHandle_t CANReadTask;
 
+// the handlers send through the transmit queue, only the CAN transmit task uses the driver
 AbstractCanMessageSender* CANInterface;
+CanTransmitQueue* canTransmitQueue;
 ICanDisplayPopupHandler* canPopupHandler;
 CanVinHandler* canVinHandler;
 CanTripInfoHandler* tripInfoHandler;
@@ -117,6 +181,7 @@ CanTripInfoHandler* tripInfoHandler;
 CanRadioRemoteMessageHandler* canRadioRemoteMessageHandler;
 CanStatusOfFunctionsHandler* canStatusOfFunctionsHandler;
 CanWarningLogHandler* canWarningLogHandler;
+CanBridgeEventDispatcher* canBridgeEventDispatcher;
 CanSpeedAndRpmHandler* canSpeedAndRpmHandler;
 CanDash2MessageHandler* canDash2MessageHandler;
 CanDash3MessageHandler* canDash3MessageHandler;
@@ -137,103 +202,216 @@ CanIgnitionTask* canIgnitionTask;
 CanDataSenderTask* canDataSenderTask;
 CanDataReaderTask* canDataReaderTask;
 VanDataParserTask* vanDataParserTask;
+VanReceiverTask* vanReceiverTask;
+VanReaderTask* vanReaderTask;
+VanFrameRing vanFrameRing;
+VanTrafficStatistics vanTrafficStatistics;
+CanHeartbeatScheduler canHeartbeatScheduler;
+CanFrameSequencer canFrameSequencer;
 VanWriterTask* vanWriterTask;
 
 SerialReader* serialReader;
 
 AbsSer *serialPort;
 
+/*
+    The storage of the objects setup() creates, grouped by subsystem. Nothing is created on the heap, so after boot the heap
+    is left to the FreeRTOS and Bluetooth stacks, and the size of each group is fixed at build time (see AddStaticMemorySections).
+*/
+struct CanObjects {
+    StaticInstance<CanMessageSenderEsp32Idf> Driver;
+    StaticInstance<CanTransmitQueue> TransmitQueue;
+#if POPUP_HANDLER == 1
+    StaticInstance<CanDisplayPopupHandler> PopupHandler;
+#endif
+#if POPUP_HANDLER == 2
+    StaticInstance<CanDisplayPopupHandler2> PopupHandler;
+#endif
+#if POPUP_HANDLER == 3
+    StaticInstance<CanDisplayPopupHandler3> PopupHandler;
+#endif
+#ifdef SEND_AC_CHANGES_TO_DISPLAY
+    StaticInstance<CanAirConOnDisplayHandler> AirConOnDisplayHandler;
+#endif
+    StaticInstance<CanVinHandler> VinHandler;
+    StaticInstance<CanTripInfoHandler> TripInfoHandler;
+    StaticInstance<CanRadioRemoteMessageHandler> RadioRemoteMessageHandler;
+    StaticInstance<CanStatusOfFunctionsHandler> StatusOfFunctionsHandler;
+    StaticInstance<CanWarningLogHandler> WarningLogHandler;
+    StaticInstance<CanSpeedAndRpmHandler> SpeedAndRpmHandler;
+    StaticInstance<CanDash2MessageHandler> Dash2MessageHandler;
+    StaticInstance<CanDash3MessageHandler> Dash3MessageHandler;
+    StaticInstance<CanDash4MessageHandler> Dash4MessageHandler;
+    StaticInstance<CanIgnitionPacketSender> RadioIgnition;
+    StaticInstance<CanDashIgnitionPacketSender> DashIgnition;
+    StaticInstance<CanParkingAidHandler> ParkingAid;
+    StaticInstance<CanRadioButtonPacketSender> RadioButtonSender;
+    StaticInstance<CanNaviPositionHandler> NaviPositionHandler;
+    StaticInstance<CanMessageHandlerContainer> MessageHandlerContainer;
+    StaticInstance<CanBridgeEventDispatcher> BridgeEventDispatcher;
+} canObjects;
+
+struct VanObjects {
+    StaticInstance<VanMessageReaderEsp32Rmt> Reader;
+    StaticInstance<VanHandlerContainer> HandlerContainer;
+    StaticInstance<VanWriterTask> WriterTask;
+} vanObjects;
+
+struct TaskObjects {
+    StaticInstance<CanIgnitionTask> CanIgnition;
+    StaticInstance<CanDataSenderTask> CanDataSender;
+    StaticInstance<CanDataReaderTask> CanDataReader;
+    StaticInstance<VanDataParserTask> VanDataParser;
+    StaticInstance<VanReceiverTask> VanReceiver;
+    StaticInstance<VanReaderTask> VanReader;
+} taskObjects;
+
+struct SystemObjects {
+#ifdef USE_BLUETOOTH_SERIAL
+    StaticInstance<BluetoothSerAbs> SerialPort;
+#else
+    StaticInstance<HwSerAbs> SerialPort;
+#endif
+    StaticInstance<VinFlashStorageEsp32> VinFlashStorage;
+    StaticInstance<GetDeviceInfoEsp32> DeviceInfo;
+    StaticInstance<DiagnosticCommands> Diagnostics;
+    StaticInstance<SerialReader> SerialReader;
+} systemObjects;
+
 unsigned long currentTime = 0;
 
 #ifdef USE_BLUETOOTH_SERIAL
     BluetoothSerial SerialBT;
 #endif
 
-void PrintArrayToSerial(const uint8_t vanMessage[], uint8_t vanMessageLength)
+void CANReadTaskFunction(void * parameter)
 {
-    char tmp[3];
-    for (uint8_t i = 0; i < vanMessageLength; i++)
+    for (;;)
     {
-        snprintf(tmp, 3, "%02X", vanMessage[i]);
-        if (i != vanMessageLength - 1)
-        {
-            serialPort->print(tmp);
-            serialPort->print(" ");
-        }
-        else
+        taskProfiler.BeginCycle(TASK_CAN_READ);
+        // ReadData() blocks for up to 10 ms waiting for a message, the delay only keeps the loop from spinning when the driver returns at once
+        const bool messageRead = canDataReaderTask->ReadData();
+        taskProfiler.EndCycle(TASK_CAN_READ);
+
+        if (!messageRead)
         {
-            serialPort->println(tmp);
+            vTaskDelay(1 / portTICK_PERIOD_MS);
         }
+        esp_task_wdt_reset();
     }
 }
 
-void CANReadTaskFunction(void * parameter)
+void CANTransmitTaskFunction(void * parameter)
 {
+    bool isSequenceActive = false;
+
+    // this task is created first and runs at once on its core, so the handle is set before the other tasks send anything
+    canTransmitQueue->SetTransmitTask(xTaskGetCurrentTaskHandle());
+    canFrameSequencer.SetProcessTask(xTaskGetCurrentTaskHandle());
+
     for (;;)
     {
-        canDataReaderTask->ReadData();
+        canTransmitQueue->WaitForMessages(isSequenceActive ? CAN_SEQUENCE_WAIT : CAN_TRANSMIT_MAX_WAIT);
+
+        taskProfiler.BeginCycle(TASK_CAN_TRANSMIT);
+        canTransmitQueue->TransmitMessages();
+        // the sequences queue their frames, they are sent by the next TransmitMessages()
+        isSequenceActive = canFrameSequencer.Process(millis());
+        taskProfiler.EndCycle(TASK_CAN_TRANSMIT);
 
-        vTaskDelay(10 / portTICK_PERIOD_MS);
         esp_task_wdt_reset();
     }
 }
 
+/*
+    Sleeps until the next cycle of the task. The heartbeats of the lane which are due before that are sent at their deadlines,
+    so a message does not have to wait for the cycle of the task feeding it.
+*/
+void WaitForNextCycle(uint8_t lane, TickType_t* previousWakeTime, TickType_t period)
+{
+    unsigned long deadline;
+    for (;;)
+    {
+        canHeartbeatScheduler.Process(lane, millis());
+
+        if (!canHeartbeatScheduler.GetNextDeadline(lane, deadline))
+        {
+            break;
+        }
+
+        const int32_t ticksToCycle = (int32_t)(*previousWakeTime + period - xTaskGetTickCount());
+        const int32_t ticksToDeadline = (int32_t)(deadline - millis()) / (int32_t)portTICK_PERIOD_MS;
+        if (ticksToCycle <= ticksToDeadline)
+        {
+            break;
+        }
+        vTaskDelay(ticksToDeadline > 0 ? ticksToDeadline : 1);
+    }
+
+    vTaskDelayUntil(previousWakeTime, period);
+}
+
 void CANSendDataTaskFunction(void * parameter)
 {
+    // waking up relative to the previous wake time keeps the cycle from drifting by the time spent sending
+    TickType_t previousWakeTime = xTaskGetTickCount();
+
     for (;;)
     {
-        canDataSenderTask->SendData(dataToBridge);
+        taskProfiler.BeginCycle(TASK_CAN_SEND_DATA, previousWakeTime);
+        canDataSenderTask->SendData(sendDataView.Take());
+        taskProfiler.EndCycle(TASK_CAN_SEND_DATA);
 
-        vTaskDelay(10 / portTICK_PERIOD_MS);
+        WaitForNextCycle(HEARTBEAT_LANE_DATA, &previousWakeTime, taskProfiler.GetPeriod(TASK_CAN_SEND_DATA));
         esp_task_wdt_reset();
     }
 }
 
 void CANSendIgnitionTaskFunction(void * parameter)
 {
+    TickType_t previousWakeTime = xTaskGetTickCount();
+
     for (;;)
     {
+        taskProfiler.BeginCycle(TASK_CAN_SEND_IGNITION, previousWakeTime);
         currentTime = millis();
 
-        canIgnitionTask->SendIgnition(ignitionDataToBridge, vinDataToBridge, currentTime);
+        canIgnitionTask->SendIgnition(sendIgnitionView.Take(), sendIgnitionVinView.Take(), currentTime);
+        taskProfiler.EndCycle(TASK_CAN_SEND_IGNITION);
 
-        vTaskDelay(40 / portTICK_PERIOD_MS);
+        WaitForNextCycle(HEARTBEAT_LANE_IGNITION, &previousWakeTime, taskProfiler.GetPeriod(TASK_CAN_SEND_IGNITION));
         esp_task_wdt_reset();
     }
 }
 
-void VANReadTaskFunction(void * parameter)
+void VANReceiveTaskFunction(void * parameter)
 {
-    uint8_t vanMessage[32];
-    uint8_t msgLength;
-
     for (;;)
     {
-        serialReader->Receive(&msgLength, vanMessage);
-
-        if (msgLength == 0)
+        taskProfiler.BeginCycle(TASK_VAN_RECEIVE);
+        if (vanReceiverTask->ReceiveData() > 0)
         {
-            vanReader->Receive(&msgLength, vanMessage);
+            taskProfiler.Trigger(TASK_VAN_READ);
+            xTaskNotifyGive(VANReadTask);
         }
+        taskProfiler.EndCycle(TASK_VAN_RECEIVE);
 
-        if (msgLength > 0 && vanReader->IsCrcOk(vanMessage, msgLength))
-        {
-            if (true)
-            {
-                PrintArrayToSerial(vanMessage, msgLength);
-            }
+        // polls the receiver, so the period is a plain delay
+        vTaskDelay(taskProfiler.GetPeriod(TASK_VAN_RECEIVE));
+        esp_task_wdt_reset();
+    }
+}
 
-            vanDataParserTask->ProcessData(vanMessage, msgLength, &dataToBridge, &ignitionDataToBridge, &vinDataToBridge);
-        }
+void VANReadTaskFunction(void * parameter)
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, VAN_READ_MAX_WAIT);
 
-        if (!USE_IGNITION_SIGNAL_FROM_VAN_BUS)
-        {
-            dataToBridge.Ignition = 1;
-            ignitionDataToBridge.Ignition = 1;
-            ignitionDataToBridge.EconomyModeActive = 0;
-        }
+        taskProfiler.BeginCycle(TASK_VAN_READ);
+        vanReaderTask->ReadData(dataToBridgeSnapshot, ignitionDataToBridgeSnapshot, vinDataToBridgeSnapshot);
+        taskProfiler.EndCycle(TASK_VAN_READ);
 
-        vTaskDelay(10 / portTICK_PERIOD_MS);
         esp_task_wdt_reset();
     }
 }
@@ -241,17 +419,42 @@ void VANReadTaskFunction(void * parameter)
 #if HW_VERSION == 14
 void VANWriteTaskFunction(void* parameter)
 {
+    TickType_t previousWakeTime = xTaskGetTickCount();
+
     for (;;)
     {
+        taskProfiler.BeginCycle(TASK_VAN_WRITE, previousWakeTime);
         currentTime = millis();
-        vanWriterTask->Process(ignitionDataToBridge, currentTime);
 
-        vTaskDelay(10 / portTICK_PERIOD_MS);
+        vanWriterTask->Process(vanWriteView.Take(), currentTime);
+        taskProfiler.EndCycle(TASK_VAN_WRITE);
+
+        vTaskDelayUntil(&previousWakeTime, taskProfiler.GetPeriod(TASK_VAN_WRITE));
         esp_task_wdt_reset();
     }
 }
 #endif
 
+/*
+    Where the tasks run, in the order of TaskIndex, which is also the order they are created in:
+    the CAN transmit task first as the others send CAN messages through it, the VAN read task before the VAN receive task which notifies it.
+    The period is 0 for the tasks woken up by an event (or by the CAN driver).
+*/
+const TaskProfile taskProfiles[] = {
+    // name                  function                        stack  priority  core  period  handle
+    { "CANTransmitTask",     CANTransmitTaskFunction,        10000, 3,        0,    0,      &CANTransmitTask },
+    { "CANSendIgnitionTask", CANSendIgnitionTaskFunction,    15000, 2,        0,    40,     &CANSendIgnitionTask },
+    { "CANSendDataTask",     CANSendDataTaskFunction,        15000, 0,        0,    10,     &CANSendDataTask },
+    { "VANReadTask",         VANReadTaskFunction,            20000, 1,        1,    0,      &VANReadTask },
+    { "VANReceiveTask",      VANReceiveTaskFunction,         10000, 2,        1,    1,      &VANReceiveTask },
+    { "CANReadTask",         CANReadTaskFunction,            10000, 0,        1,    0,      &CANReadTask },
+#if HW_VERSION == 14
+    { "VANWriteTask",        VANWriteTaskFunction,           20000, 1,        1,    10,     &VANWriteTask },
+#endif
+};
+
+static_assert(sizeof(taskProfiles) / sizeof(taskProfiles[0]) == TASK_COUNT, "every task needs a profile");
+
 void InitSerialPort()
 {
     uint16_t uniqueIdForBluetooth = 0;
@@ -261,21 +464,39 @@ void InitSerialPort()
     snprintf(bluetoothDeviceName, 27, "VAN-CAN Bridge %04X", uniqueIdForBluetooth);
 
 #ifdef USE_BLUETOOTH_SERIAL
-    serialPort = new BluetoothSerAbs(SerialBT, bluetoothDeviceName);
+    serialPort = systemObjects.SerialPort.Create(SerialBT, bluetoothDeviceName);
 #else
-    serialPort = new HwSerAbs(Serial);
+    serialPort = systemObjects.SerialPort.Create(Serial);
 #endif
 
     serialPort->begin(500000);
     serialPort->println(bluetoothDeviceName);
 }
 
+/* The sizes are known at build time, the memory report shows them next to the heap and the task stacks */
+void AddStaticMemorySections()
+{
+    const size_t snapshotsSize =
+        sizeof(dataToBridgeSnapshot) + sizeof(ignitionDataToBridgeSnapshot) + sizeof(vinDataToBridgeSnapshot) +
+        sizeof(sendDataView) + sizeof(sendIgnitionView) + sizeof(sendIgnitionVinView)
+#if HW_VERSION == 14
+        + sizeof(vanWriteView)
+#endif
+        ;
+
+    memoryReport.AddStaticSection("CAN", sizeof(canObjects) + sizeof(canHeartbeatScheduler) + sizeof(canFrameSequencer));
+    memoryReport.AddStaticSection("VAN", sizeof(vanObjects) + sizeof(vanFrameRing) + sizeof(vanTrafficStatistics));
+    memoryReport.AddStaticSection("bridge", snapshotsSize + sizeof(signalBus) + sizeof(bridgeEventQueue));
+    memoryReport.AddStaticSection("tasks", sizeof(taskObjects) + sizeof(taskProfiler) + sizeof(memoryReport));
+    memoryReport.AddStaticSection("system", sizeof(systemObjects));
+}
+
 void setup()
 {
-    vinFlashStorage = new VinFlashStorageEsp32();
-    deviceInfo = new GetDeviceInfoEsp32();
+    vinFlashStorage = systemObjects.VinFlashStorage.Create();
+    deviceInfo = systemObjects.DeviceInfo.Create();
 
-    vanReader = new VanMessageReaderEsp32Rmt(VAN_DATA_RX_PIN, VAN_DATA_RX_LED_INDICATOR_PIN, VAN_DATA_RX_LINE_LEVEL, NETWORK_TYPE_COMFORT);
+    vanReader = vanObjects.Reader.Create(VAN_DATA_RX_PIN, VAN_DATA_RX_LED_INDICATOR_PIN, VAN_DATA_RX_LINE_LEVEL, NETWORK_TYPE_COMFORT);
     vanReader->Init();
 
     InitSerialPort();
@@ -287,106 +508,87 @@ void setup()
     }
 
     //CANInterface = new CanMessageSender(CAN_RX_PIN, CAN_TX_PIN);
-    CANInterface = new CanMessageSenderEsp32Idf(CAN_RX_PIN, CAN_TX_PIN, false, serialPort);
-    CANInterface->Init();
+    canTransmitQueue = canObjects.TransmitQueue.Create(canObjects.Driver.Create(CAN_RX_PIN, CAN_TX_PIN, false, serialPort));
+    canTransmitQueue->Init();
+    CANInterface = canTransmitQueue;
 
 #if POPUP_HANDLER == 1
-    canPopupHandler = new CanDisplayPopupHandler(CANInterface);
+    canPopupHandler = canObjects.PopupHandler.Create(CANInterface);
 #endif
 #if POPUP_HANDLER == 2
-    canPopupHandler = new CanDisplayPopupHandler2(CANInterface);
+    canPopupHandler = canObjects.PopupHandler.Create(CANInterface);
 #endif
 #if POPUP_HANDLER == 3
-    canPopupHandler = new CanDisplayPopupHandler3(CANInterface);
+    canPopupHandler = canObjects.PopupHandler.Create(CANInterface);
 #endif
 
 #ifdef SEND_AC_CHANGES_TO_DISPLAY
-    canAirConOnDisplayHandler = new CanAirConOnDisplayHandler(CANInterface);
+    canAirConOnDisplayHandler = canObjects.AirConOnDisplayHandler.Create(CANInterface);
+#endif
+
+    canVinHandler = canObjects.VinHandler.Create(CANInterface);
+    tripInfoHandler = canObjects.TripInfoHandler.Create(CANInterface);
+    canRadioRemoteMessageHandler = canObjects.RadioRemoteMessageHandler.Create(CANInterface);
+    canStatusOfFunctionsHandler = canObjects.StatusOfFunctionsHandler.Create(CANInterface);
+    canWarningLogHandler = canObjects.WarningLogHandler.Create(CANInterface);
+    canSpeedAndRpmHandler = canObjects.SpeedAndRpmHandler.Create(CANInterface);
+    canDash2MessageHandler = canObjects.Dash2MessageHandler.Create(CANInterface);
+    canDash3MessageHandler = canObjects.Dash3MessageHandler.Create(CANInterface);
+    canDash4MessageHandler = canObjects.Dash4MessageHandler.Create(CANInterface);
+    radioIgnition = canObjects.RadioIgnition.Create(CANInterface);
+    dashIgnition = canObjects.DashIgnition.Create(CANInterface);
+    canParkingAid = canObjects.ParkingAid.Create(CANInterface);
+    canRadioButtonSender = canObjects.RadioButtonSender.Create(CANInterface);
+    canNaviPositionHandler = canObjects.NaviPositionHandler.Create(CANInterface);
+
+    canHeartbeatScheduler.Register(canSpeedAndRpmHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canDash2MessageHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canDash3MessageHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canDash4MessageHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canRadioRemoteMessageHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canNaviPositionHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canParkingAid, HEARTBEAT_LANE_IGNITION);
+#if defined(SEND_AC_CHANGES_TO_DISPLAY) && defined(USE_NEW_AIRCON_DISPLAY_SENDER)
+    canHeartbeatScheduler.Register(canAirConOnDisplayHandler, HEARTBEAT_LANE_DATA);
 #endif
 
-    canVinHandler = new CanVinHandler(CANInterface);
-    tripInfoHandler = new CanTripInfoHandler(CANInterface);
-    canRadioRemoteMessageHandler = new CanRadioRemoteMessageHandler(CANInterface);
-    canStatusOfFunctionsHandler = new CanStatusOfFunctionsHandler(CANInterface);
-    canWarningLogHandler = new CanWarningLogHandler(CANInterface);
-    canSpeedAndRpmHandler = new CanSpeedAndRpmHandler(CANInterface);
-    canDash2MessageHandler = new CanDash2MessageHandler(CANInterface);
-    canDash3MessageHandler = new CanDash3MessageHandler(CANInterface);
-    canDash4MessageHandler = new CanDash4MessageHandler(CANInterface);
-    radioIgnition = new CanIgnitionPacketSender(CANInterface);
-    dashIgnition = new CanDashIgnitionPacketSender(CANInterface);
-    canParkingAid = new CanParkingAidHandler(CANInterface);
-    canRadioButtonSender = new CanRadioButtonPacketSender(CANInterface);
-    canNaviPositionHandler = new CanNaviPositionHandler(CANInterface);
-
-    canMessageHandlerContainer = new CanMessageHandlerContainer(CANInterface, serialPort, vinFlashStorage);
-
-    vanHandlerContainer = new VanHandlerContainer(
+    canMessageHandlerContainer = canObjects.MessageHandlerContainer.Create(CANInterface, serialPort, vinFlashStorage);
+
+    canBridgeEventDispatcher = canObjects.BridgeEventDispatcher.Create(
+        &bridgeEventQueue,
         canPopupHandler,
         tripInfoHandler,
         canStatusOfFunctionsHandler,
         canWarningLogHandler,
         canRadioRemoteMessageHandler);
 
-    serialReader = new SerialReader(serialPort, CANInterface, tripInfoHandler, canRadioButtonSender, vinFlashStorage);
-    canIgnitionTask = new CanIgnitionTask(radioIgnition, dashIgnition, canParkingAid, canRadioRemoteMessageHandler, canStatusOfFunctionsHandler, canPopupHandler, canWarningLogHandler, canVinHandler);
-    canDataSenderTask = new CanDataSenderTask(
+    vanHandlerContainer = vanObjects.HandlerContainer.Create(&bridgeEventQueue, &signalBus);
+
+    DiagnosticCommands* diagnosticCommands = systemObjects.Diagnostics.Create(
+        serialPort, &bridgeEventQueue, vanHandlerContainer, &vanTrafficStatistics, &canHeartbeatScheduler, canTransmitQueue, &taskProfiler, &memoryReport);
+    serialReader = systemObjects.SerialReader.Create(serialPort, CANInterface, &bridgeEventQueue, vinFlashStorage, diagnosticCommands);
+    canIgnitionTask = taskObjects.CanIgnition.Create(radioIgnition, dashIgnition, canParkingAid, canPopupHandler, canVinHandler, &bridgeEventQueue, &signalBus);
+    canDataSenderTask = taskObjects.CanDataSender.Create(
         canSpeedAndRpmHandler, tripInfoHandler, canPopupHandler, canRadioRemoteMessageHandler, canDash2MessageHandler, canDash3MessageHandler,
-        canDash4MessageHandler, canRadioButtonSender, canNaviPositionHandler
+        canDash4MessageHandler, canRadioButtonSender, canNaviPositionHandler, canBridgeEventDispatcher, &signalBus
 #ifdef SEND_AC_CHANGES_TO_DISPLAY
         , canAirConOnDisplayHandler
 #endif
         );
-    canDataReaderTask = new CanDataReaderTask(CANInterface, canPopupHandler, canRadioRemoteMessageHandler, canMessageHandlerContainer, canDataSenderTask);
-    vanDataParserTask = new VanDataParserTask(serialPort, canVinHandler, vanHandlerContainer);
-    vanWriterTask = new VanWriterTask();
-
-    xTaskCreatePinnedToCore(
-        CANSendIgnitionTaskFunction,    // Function to implement the task
-        "CANSendIgnitionTask",          // Name of the task
-        15000,                          // Stack size in words
-        NULL,                           // Task input parameter
-        2,                              // Priority of the task
-        &CANSendIgnitionTask,           // Task handle.
-        0);                             // Core where the task should run
-
-    xTaskCreatePinnedToCore(
-        CANSendDataTaskFunction,        // Function to implement the task
-        "CANSendDataTask",              // Name of the task
-        15000,                          // Stack size in words
-        NULL,                           // Task input parameter
-        0,                              // Priority of the task
-        &CANSendDataTask,               // Task handle.
-        0);                             // Core where the task should run
-
-    xTaskCreatePinnedToCore(
-        VANReadTaskFunction,            // Function to implement the task
-        "VANReadTask",                  // Name of the task
-        20000,                          // Stack size in words
-        NULL,                           // Task input parameter
-        1,                              // Priority of the task
-        &VANReadTask,                   // Task handle.
-        1);                             // Core where the task should run
-
-    xTaskCreatePinnedToCore(
-        CANReadTaskFunction,            // Function to implement the task
-        "CANReadTask",                  // Name of the task
-        10000,                          // Stack size in words
-        NULL,                           // Task input parameter
-        0,                              // Priority of the task
-        &CANReadTask,                   // Task handle.
-        1);                             // Core where the task should run
+    canDataReaderTask = taskObjects.CanDataReader.Create(CANInterface, &bridgeEventQueue, canMessageHandlerContainer, canDataSenderTask);
+    vanDataParserTask = taskObjects.VanDataParser.Create(serialPort, canVinHandler, vanHandlerContainer);
+    vanReceiverTask = taskObjects.VanReceiver.Create(vanReader, serialReader, &vanFrameRing);
+    vanReaderTask = taskObjects.VanReader.Create(vanReader, &vanFrameRing, vanDataParserTask, &vanTrafficStatistics, serialPort);
+    vanWriterTask = vanObjects.WriterTask.Create();
 
-#if HW_VERSION == 14
-    xTaskCreatePinnedToCore(
-        VANWriteTaskFunction,                        // Function to implement the task
-        "VANWriteTask",                  // Name of the task
-        20000,                          // Stack size in words
-        NULL,                           // Task input parameter
-        1,                              // Priority of the task
-        &VANWriteTask,                   // Task handle.
-        1);                             // Core where the task should run
-#endif
+    canFrameSequencer.Register(tripInfoHandler->GetFrameSequence());
+    canFrameSequencer.Register(canPopupHandler->GetFrameSequence());
+    canFrameSequencer.Register(serialReader->GetFrameSequence());
+
+    AddStaticMemorySections();
+    memoryReport.Print(serialPort);
+
+    taskProfiler.CreateTasks(taskProfiles, TASK_COUNT);
 
     esp_task_wdt_init(TASK_WATCHDOG_TIMEOUT, true);
     esp_task_wdt_add(VANReadTask);
@@ -396,4 +598,8 @@ void loop()
 {
     vTaskDelay(50 / portTICK_PERIOD_MS);
     esp_task_wdt_reset();
+
+    // the serial commands are handled here, not in the VAN receive task, printing the tables takes milliseconds
+    serialReader->Process();
+    memoryReport.Log(serialPort, millis());
 }
@@ -5,6 +5,10 @@
 
 #include <stdint.h>
 
+// the results of SendMessage()
+const uint8_t CAN_SEND_OK = 0;
+const uint8_t CAN_SEND_FAILED = 0xFF;
+
 class AbstractCanMessageSender {
   public:
     virtual void Init() = 0; // The '= 0;' makes whole class "pure virtual"
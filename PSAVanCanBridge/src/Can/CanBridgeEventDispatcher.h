@@ -0,0 +1,135 @@
+// CanBridgeEventDispatcher.h
+#pragma once
+
+#ifndef _CanBridgeEventDispatcher_h
+    #define _CanBridgeEventDispatcher_h
+
+#include "../Helpers/BridgeEventQueue.h"
+#include "../Helpers/CanDisplayPopupItem.h"
+#include "Handlers/ICanDisplayPopupHandler.h"
+#include "Handlers/CanTripInfoHandler.h"
+#include "Handlers/CanStatusOfFunctionsHandler.h"
+#include "Handlers/CanWarningLogHandler.h"
+#include "Handlers/CanRadioRemoteMessageHandler.h"
+
+/*
+    Applies the events of the BridgeEventQueue to the CAN handlers. The CAN data task calls Process() every cycle,
+    which makes it the only task changing the state of these handlers, the other tasks only push events.
+*/
+class CanBridgeEventDispatcher
+{
+    BridgeEventQueue* _eventQueue;
+
+    ICanDisplayPopupHandler* _canPopupHandler;
+    CanTripInfoHandler* _tripInfoHandler;
+    CanStatusOfFunctionsHandler* _canStatusOfFunctionsHandler;
+    CanWarningLogHandler* _canWarningLogHandler;
+    CanRadioRemoteMessageHandler* _canRadioRemoteMessageHandler;
+
+    void QueuePopup(const BridgeEventPopup& popup)
+    {
+        CanDisplayPopupItem item;
+        item.Category = popup.Category;
+        item.MessageType = popup.MessageType;
+        item.DisplayTimeInMilliSeconds = 0;
+        item.DoorStatus1 = popup.DoorStatus1;
+        item.DoorStatus2 = popup.DoorStatus2;
+        item.KmToDisplay = 0;
+        item.IsInited = false;
+        item.Counter = 0;
+        item.Visible = false;
+        item.SetVisibleOnDisplayTime = 0;
+        item.VANByte = popup.VANByte;
+        _canPopupHandler->QueueNewMessage(item);
+    }
+
+    void Dispatch(const BridgeEvent& event)
+    {
+        switch (event.Type)
+        {
+            case BRIDGE_EVENT_RADIO_REMOTE:
+                _canRadioRemoteMessageHandler->SetData(event.RadioRemote.Button, event.RadioRemote.Scroll);
+                break;
+            case BRIDGE_EVENT_TRIP_BUTTON_PRESSED:
+                _tripInfoHandler->TripButtonPress();
+                break;
+            case BRIDGE_EVENT_TRIP_RESET:
+                _tripInfoHandler->TripResetHappened();
+                break;
+            case BRIDGE_EVENT_POPUP_RAISED:
+                QueuePopup(event.Popup);
+                break;
+            case BRIDGE_EVENT_POPUP_HIDE_REQUESTED:
+                if (_canPopupHandler->IsPopupVisible())
+                {
+                    _canPopupHandler->HideCurrentPopupMessage();
+                }
+                break;
+            case BRIDGE_EVENT_SEAT_BELT_WARNING_RESET:
+                _canPopupHandler->ResetSeatBeltWarning();
+                break;
+            case BRIDGE_EVENT_PASSENGER_AIRBAG_DISABLED:
+                _canStatusOfFunctionsHandler->SetPassengerAirbagDisabled();
+                break;
+            case BRIDGE_EVENT_AUTOMATIC_HEADLAMP_ENABLED:
+                _canStatusOfFunctionsHandler->SetAutomaticHeadlampEnabled();
+                break;
+            case BRIDGE_EVENT_AUTOMATIC_HEADLAMP_DISABLED:
+                _canStatusOfFunctionsHandler->SetAutomaticHeadlampDisabled();
+                break;
+            case BRIDGE_EVENT_AUTOMATIC_DOOR_LOCKING_ENABLED:
+                _canStatusOfFunctionsHandler->SetAutomaticDoorLockingEnabled();
+                break;
+            case BRIDGE_EVENT_GEARBOX_FAULT:
+                _canWarningLogHandler->SetGearBoxFault();
+                break;
+            case BRIDGE_EVENT_ENGINE_FAULT_REPAIR_NEEDED:
+                _canWarningLogHandler->SetEngineFaultRepairNeeded();
+                break;
+            case BRIDGE_EVENT_HEAD_UNIT_DETECTED:
+                _canRadioRemoteMessageHandler->IsAndroidInstalled(false);
+                break;
+            case BRIDGE_EVENT_IGNITION_OFF:
+                _canRadioRemoteMessageHandler->IsAndroidInstalled(true);
+                _canPopupHandler->Reset();
+                _canStatusOfFunctionsHandler->Reset();
+                _canWarningLogHandler->Reset();
+                break;
+            default:
+                break;
+        }
+    }
+
+public:
+    CanBridgeEventDispatcher(
+        BridgeEventQueue* eventQueue,
+        ICanDisplayPopupHandler* canPopupHandler,
+        CanTripInfoHandler* tripInfoHandler,
+        CanStatusOfFunctionsHandler* canStatusOfFunctionsHandler,
+        CanWarningLogHandler* canWarningLogHandler,
+        CanRadioRemoteMessageHandler* canRadioRemoteMessageHandler
+    )
+    {
+        _eventQueue = eventQueue;
+        _canPopupHandler = canPopupHandler;
+        _tripInfoHandler = tripInfoHandler;
+        _canStatusOfFunctionsHandler = canStatusOfFunctionsHandler;
+        _canWarningLogHandler = canWarningLogHandler;
+        _canRadioRemoteMessageHandler = canRadioRemoteMessageHandler;
+    }
+
+    void Process()
+    {
+        BridgeEvent event;
+        while (_eventQueue->Pop(event))
+        {
+            Dispatch(event);
+        }
+
+        // sends the status of functions and the warning log once after a reset
+        _canStatusOfFunctionsHandler->Init();
+        _canWarningLogHandler->Init();
+    }
+};
+
+#endif
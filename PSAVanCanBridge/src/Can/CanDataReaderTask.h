@@ -7,8 +7,7 @@
 #include "AbstractCanMessageSender.h"
 #include "CanMessageHandlerContainer.h"
 #include "CanDataSenderTask.h"
-#include "Handlers/CanRadioRemoteMessageHandler.h"
-#include "Handlers/ICanDisplayPopupHandler.h"
+#include "../Helpers/BridgeEventQueue.h"
 
 class CanDataReaderTask {
     uint8_t canReadMessage[20] = { 0 };
@@ -16,27 +15,25 @@ class CanDataReaderTask {
     uint16_t canId = 0;
 
     AbstractCanMessageSender* _CANInterface;
-    ICanDisplayPopupHandler* _canPopupHandler;
-    CanRadioRemoteMessageHandler* _canRadioRemoteMessageHandler;
+    BridgeEventQueue* _events;
     CanMessageHandlerContainer* _canMessageHandlerContainer;
     CanDataSenderTask* _canDataSenderTask;
 public:
     CanDataReaderTask(
         AbstractCanMessageSender* CANInterface,
-        ICanDisplayPopupHandler* canPopupHandler,
-        CanRadioRemoteMessageHandler* canRadioRemoteMessageHandler,
+        BridgeEventQueue* eventQueue,
         CanMessageHandlerContainer* canMessageHandlerContainer,
         CanDataSenderTask* canDataSenderTask
     )
     {
         _CANInterface = CANInterface;
-        _canPopupHandler = canPopupHandler;
-        _canRadioRemoteMessageHandler = canRadioRemoteMessageHandler;
+        _events = eventQueue;
         _canMessageHandlerContainer = canMessageHandlerContainer;
         _canDataSenderTask = canDataSenderTask;
     }
 
-    void ReadData() {
+    /* Returns true if a message was read from the bus */
+    bool ReadData() {
         canId = 0;
         canReadMessageLength = 0;
         _CANInterface->ReadMessage(&canId, &canReadMessageLength, canReadMessage);
@@ -47,16 +44,16 @@ class CanDataReaderTask {
             {
                 // the RD4/43/45 units are sending this regularly so if we get this message we can be sure that we have one of those installed
                 _canDataSenderTask->SendNoRadioButtonMessage = false;
-                _canRadioRemoteMessageHandler->IsAndroidInstalled(false);
+                _events->Push(BRIDGE_EVENT_HEAD_UNIT_DETECTED);
 
-                CanMenuPacket packet = DeSerialize<CanMenuPacket>(canReadMessage);
-                if (packet.data.EscOkField.esc == 1 && _canPopupHandler->IsPopupVisible())
+                if (CanMenuEscButtonField::Get(canReadMessage) == 1)
                 {
-                    _canPopupHandler->HideCurrentPopupMessage();
+                    _events->Push(BRIDGE_EVENT_POPUP_HIDE_REQUESTED);
                 }
             }
             _canMessageHandlerContainer->ProcessMessage(canId, canReadMessageLength, canReadMessage);
         }
+        return canId > 0;
     }
  };
 #endif
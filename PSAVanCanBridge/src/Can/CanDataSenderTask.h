@@ -4,8 +4,10 @@
     #define _CanDataSenderTask_h
 
 #include "../Helpers/VanDataToBridgeToCan.h"
+#include "../Helpers/SignalBus.h"
 #include "../../Config.h"
 #include "Handlers/CanNaviPositionHandler.h"
+#include "CanBridgeEventDispatcher.h"
 
 #ifdef SEND_AC_CHANGES_TO_DISPLAY
     #ifdef USE_NEW_AIRCON_DISPLAY_SENDER
@@ -16,6 +18,11 @@
 #endif
 
 class CanDataSenderTask {
+    // the order of the signals in speedAndRpmSignals
+    const static uint8_t SPEED_INDEX = 0;
+    const static uint8_t RPM_INDEX = 1;
+    const static uint8_t DISTANCE_INDEX = 2;
+
     unsigned long currentTime = 0;
     unsigned long prevRadioButtonTime = 0;
 
@@ -32,6 +39,8 @@ class CanDataSenderTask {
     uint16_t trip2Icon3Data = 0;
     uint8_t ignition = 0;
 
+    SignalSubscription<3> speedAndRpmSignals;
+
     CanSpeedAndRpmHandler* _canSpeedAndRpmHandler;
     CanTripInfoHandler* _tripInfoHandler;
     ICanDisplayPopupHandler* _canPopupHandler;
@@ -41,6 +50,7 @@ class CanDataSenderTask {
     CanDash4MessageHandler* _canDash4MessageHandler;
     CanRadioButtonPacketSender* _canRadioButtonSender;
     CanNaviPositionHandler* _canNaviPositionHandler;
+    CanBridgeEventDispatcher* _eventDispatcher;
 #ifdef SEND_AC_CHANGES_TO_DISPLAY
     CanAirConOnDisplayHandler* _canAirConOnDisplayHandler;
 #endif
@@ -57,11 +67,13 @@ class CanDataSenderTask {
         CanDash3MessageHandler* canDash3MessageHandler,
         CanDash4MessageHandler* canDash4MessageHandler,
         CanRadioButtonPacketSender* canRadioButtonSender,
-        CanNaviPositionHandler* canNaviPositionHandler
+        CanNaviPositionHandler* canNaviPositionHandler,
+        CanBridgeEventDispatcher* eventDispatcher,
+        const SignalBus* signalBus
 #ifdef SEND_AC_CHANGES_TO_DISPLAY
         ,CanAirConOnDisplayHandler* canAirConOnDisplayHandler
 #endif
-    )
+    ) : speedAndRpmSignals(signalBus, { SIGNAL_SPEED, SIGNAL_RPM, SIGNAL_DISTANCE })
     {
         _canSpeedAndRpmHandler = canSpeedAndRpmHandler;
         _tripInfoHandler = tripInfoHandler;
@@ -72,23 +84,35 @@ class CanDataSenderTask {
         _canDash4MessageHandler = canDash4MessageHandler;
         _canRadioButtonSender = canRadioButtonSender;
         _canNaviPositionHandler = canNaviPositionHandler;
+        _eventDispatcher = eventDispatcher;
 #ifdef SEND_AC_CHANGES_TO_DISPLAY
         _canAirConOnDisplayHandler = canAirConOnDisplayHandler;
 #endif
     }
 
-    void SendData(VanDataToBridgeToCan dataToBridge) {
+    void SendData(const VanDataToBridgeToCan& dataToBridge) {
         currentTime = millis();
 
+        _eventDispatcher->Process();
+
         #pragma  region SpeedAndRpm
 
-        _canSpeedAndRpmHandler->SetData(dataToBridge.Speed, dataToBridge.Rpm, dataToBridge.Distance);
+        if (speedAndRpmSignals.Update())
+        {
+            _canSpeedAndRpmHandler->SetData(
+                speedAndRpmSignals.GetValue(SPEED_INDEX),
+                speedAndRpmSignals.GetValue(RPM_INDEX),
+                speedAndRpmSignals.GetValue(DISTANCE_INDEX));
+        }
         _canSpeedAndRpmHandler->Process(currentTime);
 
         #pragma endregion
 
         #pragma region TripInfo
 
+        const uint16_t speed = speedAndRpmSignals.GetValue(SPEED_INDEX);
+        const uint16_t rpm = speedAndRpmSignals.GetValue(RPM_INDEX);
+
         if (DISPLAY_MODE == 1)
         {
             trip0Icon1Data = dataToBridge.FuelLeftToPump; //the distance remaining to be travelled
@@ -107,15 +131,15 @@ class CanDataSenderTask {
         {
             trip0Icon1Data = round(FUEL_TANK_CAPACITY_IN_LITERS * dataToBridge.FuelLevel / 100);
             trip0Icon2Data = dataToBridge.FuelConsumption; //the current consumption
-            trip0Icon3Data = dataToBridge.Speed;
+            trip0Icon3Data = speed;
 
             trip1Icon1Data = dataToBridge.Trip1Distance;
             trip1Icon2Data = dataToBridge.Trip1Consumption;
             trip1Icon3Data = dataToBridge.Trip1Speed;
 
-            trip2Icon1Data = dataToBridge.Rpm;
+            trip2Icon1Data = rpm;
             trip2Icon2Data = dataToBridge.FuelConsumption;
-            trip2Icon3Data = dataToBridge.Speed;
+            trip2Icon3Data = speed;
 
             if (dataToBridge.LeftStickButtonPressed)
             {
@@ -141,7 +165,7 @@ class CanDataSenderTask {
 
         #pragma region PopupMessage
 
-        if (dataToBridge.Rpm > 500) {
+        if (speedAndRpmSignals.GetValue(RPM_INDEX) > 500) {
             _canPopupHandler->SetEngineRunning(true);
         }
         else
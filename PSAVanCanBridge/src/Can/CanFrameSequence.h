@@ -0,0 +1,160 @@
+// CanFrameSequence.h
+#pragma once
+
+#ifndef _CanFrameSequence_h
+    #define _CanFrameSequence_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WProgram.h"
+#endif
+
+#include <atomic>
+
+#include "AbstractCanMessageSender.h"
+
+struct CanFrameSequenceStep {
+    uint16_t CanId;
+    uint8_t Length;
+    uint8_t Data[8];
+    // how many times the frame is sent
+    uint8_t RepeatCount;
+    // milliseconds after each frame before the next one is sent, 0 sends the repeats back to back
+    uint8_t Interval;
+};
+
+/*
+    Sends frames which have to be repeated (button presses, popups) without making the caller wait between the repeats.
+    Any task can append steps, they are sent in order by the task which calls Process() (the CAN transmit task, see CanFrameSequencer).
+    The steps wait in a FreeRTOS queue, so appending never blocks: if the queue is full the step is dropped.
+*/
+class CanFrameSequence
+{
+    AbstractCanMessageSender* _canMessageSender;
+    TaskHandle_t _processTask = nullptr;
+
+    QueueHandle_t steps;
+    // steps appended but not completely sent yet
+    std::atomic<uint8_t> pendingStepCount;
+
+    #pragma region Used only by the task calling Process()
+    CanFrameSequenceStep currentStep;
+    bool hasCurrentStep = false;
+    uint8_t sentCount = 0;
+    unsigned long nextSendTime = 0;
+    #pragma endregion
+
+    bool StartNextStep()
+    {
+        hasCurrentStep = xQueueReceive(steps, &currentStep, 0) == pdTRUE;
+        sentCount = 0;
+        return hasCurrentStep;
+    }
+
+public:
+    CanFrameSequence(AbstractCanMessageSender* canMessageSender, uint8_t maxStepCount)
+    {
+        _canMessageSender = canMessageSender;
+        steps = xQueueCreate(maxStepCount, sizeof(CanFrameSequenceStep));
+        pendingStepCount = 0;
+    }
+
+    /* The task calling Process(), it is notified when a step is appended */
+    void SetProcessTask(TaskHandle_t processTask)
+    {
+        _processTask = processTask;
+    }
+
+    /* Returns false if there is no room for the step */
+    bool Append(uint16_t canId, uint8_t length, const uint8_t data[], uint8_t repeatCount, uint8_t interval)
+    {
+        CanFrameSequenceStep step;
+        step.CanId = canId;
+        step.Length = length < sizeof(step.Data) ? length : sizeof(step.Data);
+        step.RepeatCount = repeatCount;
+        step.Interval = interval;
+        memcpy(step.Data, data, step.Length);
+
+        // counted before it is queued, so IsIdle() can't report an empty sequence while the step is being picked up
+        pendingStepCount.fetch_add(1, std::memory_order_relaxed);
+        if (xQueueSend(steps, &step, 0) != pdTRUE)
+        {
+            pendingStepCount.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (_processTask != nullptr)
+        {
+            xTaskNotifyGive(_processTask);
+        }
+        return true;
+    }
+
+    /* Returns true if every appended frame has been sent */
+    bool IsIdle()
+    {
+        return pendingStepCount.load(std::memory_order_relaxed) == 0;
+    }
+
+    /* Sends the frames which are due, returns true while frames are left to send */
+    bool Process(unsigned long currentTime)
+    {
+        if (!hasCurrentStep && !StartNextStep())
+        {
+            return false;
+        }
+
+        while ((long)(currentTime - nextSendTime) >= 0)
+        {
+            _canMessageSender->SendMessage(currentStep.CanId, 0, currentStep.Length, currentStep.Data);
+            sentCount++;
+            nextSendTime = currentTime + currentStep.Interval;
+
+            if (sentCount >= currentStep.RepeatCount)
+            {
+                pendingStepCount.fetch_sub(1, std::memory_order_relaxed);
+                if (!StartNextStep())
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+/*
+    Appends every frame sent through it to a sequence with the given repeat count and interval,
+    so the existing packet senders can build the frames of a sequence.
+*/
+class CanFrameSequenceWriter : public AbstractCanMessageSender
+{
+    CanFrameSequence* _sequence;
+    uint8_t _repeatCount;
+    uint8_t _interval;
+
+public:
+    CanFrameSequenceWriter(CanFrameSequence* sequence, uint8_t repeatCount, uint8_t interval)
+    {
+        _sequence = sequence;
+        _repeatCount = repeatCount;
+        _interval = interval;
+    }
+
+    void Init() override
+    {
+    }
+
+    uint8_t SendMessage(uint16_t canId, uint8_t ext, uint8_t sizeOfByteArray, uint8_t *byteArray) override
+    {
+        return _sequence->Append(canId, sizeOfByteArray, byteArray, _repeatCount, _interval) ? CAN_SEND_OK : CAN_SEND_FAILED;
+    }
+
+    void ReadMessage(uint16_t *canId, uint8_t *len, uint8_t *buf) override
+    {
+        *len = 0;
+    }
+};
+
+#endif
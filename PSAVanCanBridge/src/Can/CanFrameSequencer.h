@@ -0,0 +1,53 @@
+// CanFrameSequencer.h
+#pragma once
+
+#ifndef _CanFrameSequencer_h
+    #define _CanFrameSequencer_h
+
+#include "CanFrameSequence.h"
+
+/* Runs the frame sequences of the handlers from one task */
+class CanFrameSequencer
+{
+    const static uint8_t MAX_SEQUENCE_COUNT = 8;
+
+    CanFrameSequence* sequences[MAX_SEQUENCE_COUNT];
+    uint8_t sequenceCount = 0;
+
+public:
+    /* Has to be called before the processing task starts */
+    bool Register(CanFrameSequence* sequence)
+    {
+        if (sequence == nullptr || sequenceCount == MAX_SEQUENCE_COUNT)
+        {
+            return false;
+        }
+        sequences[sequenceCount] = sequence;
+        sequenceCount++;
+        return true;
+    }
+
+    void SetProcessTask(TaskHandle_t processTask)
+    {
+        for (uint8_t i = 0; i < sequenceCount; i++)
+        {
+            sequences[i]->SetProcessTask(processTask);
+        }
+    }
+
+    /* Returns true while any sequence has frames left to send */
+    bool Process(unsigned long currentTime)
+    {
+        bool isActive = false;
+        for (uint8_t i = 0; i < sequenceCount; i++)
+        {
+            if (sequences[i]->Process(currentTime))
+            {
+                isActive = true;
+            }
+        }
+        return isActive;
+    }
+};
+
+#endif
@@ -0,0 +1,257 @@
+// CanHeartbeatScheduler.h
+#pragma once
+
+#ifndef _CanHeartbeatScheduler_h
+    #define _CanHeartbeatScheduler_h
+
+#include "Handlers/CanMessageHandlerBase.h"
+#include "../SerialPort/AbstractSerial.h"
+
+/* A periodic CAN message with its deadline and how precisely it was sent */
+struct CanHeartbeat {
+    CanMessageHandlerBase* Handler;
+    uint8_t Lane;
+    // delay of the first heartbeat, so messages with the same period are not sent on the same millisecond
+    uint16_t PhaseOffset;
+    unsigned long Deadline;
+    unsigned long PreviousSendTime;
+
+    #pragma region Statistics
+    uint32_t SentCount;
+    // heartbeats sent more than a whole period late, the skipped periods are not sent
+    uint32_t MissedCount;
+    // how late the heartbeats were sent compared to their deadline (in milliseconds)
+    uint32_t LatenessSum;
+    uint16_t MaxLateness;
+    // the largest difference between the time of two consecutive heartbeats and the period (in milliseconds)
+    uint16_t MaxJitter;
+    #pragma endregion
+};
+
+/*
+    Sends the heartbeats of the periodic CAN messages at their deadlines. The deadlines are derived from the first one
+    (shifted by the phase offset), so the period does not drift with how late a heartbeat is sent.
+    A handler has to be sent from the task which feeds it with data, so the handlers are registered in lanes, one per task.
+    Each lane is a min-heap of deadlines, the task sleeps until the earliest deadline of its lane or its own next cycle,
+    whichever comes first, and calls Process() when it wakes up.
+*/
+class CanHeartbeatScheduler
+{
+    const static uint8_t MAX_HANDLER_COUNT = 16;
+    const static uint8_t MAX_LANE_COUNT = 4;
+    // offsets are multiples of this, so the handlers registered one after another are spread over the period
+    const static uint8_t PHASE_STEP = 10;
+    // a heartbeat is skipped if the handler was not processed in this time (the parking aid outside reverse),
+    // longer than the cycle of the slowest task feeding the handlers (40 ms)
+    const static uint16_t PROCESS_TIMEOUT = 100;
+
+    CanHeartbeat heartbeats[MAX_HANDLER_COUNT];
+    uint8_t heartbeatCount = 0;
+
+    // indexes into heartbeats, the one with the earliest deadline first
+    uint8_t laneHeaps[MAX_LANE_COUNT][MAX_HANDLER_COUNT];
+    uint8_t laneSizes[MAX_LANE_COUNT];
+    bool isLaneStarted[MAX_LANE_COUNT];
+
+    bool IsEarlier(uint8_t heartbeatIndex, uint8_t otherIndex)
+    {
+        return (long)(heartbeats[heartbeatIndex].Deadline - heartbeats[otherIndex].Deadline) < 0;
+    }
+
+    void SiftUp(uint8_t heap[], uint8_t position)
+    {
+        while (position > 0)
+        {
+            const uint8_t parent = (position - 1) / 2;
+            if (!IsEarlier(heap[position], heap[parent]))
+            {
+                return;
+            }
+            const uint8_t swap = heap[position];
+            heap[position] = heap[parent];
+            heap[parent] = swap;
+            position = parent;
+        }
+    }
+
+    void SiftDown(uint8_t heap[], uint8_t size, uint8_t position)
+    {
+        for (;;)
+        {
+            const uint8_t left = position * 2 + 1;
+            const uint8_t right = left + 1;
+            uint8_t earliest = position;
+
+            if (left < size && IsEarlier(heap[left], heap[earliest]))
+            {
+                earliest = left;
+            }
+            if (right < size && IsEarlier(heap[right], heap[earliest]))
+            {
+                earliest = right;
+            }
+            if (earliest == position)
+            {
+                return;
+            }
+
+            const uint8_t swap = heap[position];
+            heap[position] = heap[earliest];
+            heap[earliest] = swap;
+            position = earliest;
+        }
+    }
+
+    /* The first deadlines are counted from the first Process() of the lane */
+    void StartLane(uint8_t lane, unsigned long currentTime)
+    {
+        for (uint8_t i = 0; i < heartbeatCount; i++)
+        {
+            if (heartbeats[i].Lane == lane)
+            {
+                heartbeats[i].Deadline = currentTime + heartbeats[i].PhaseOffset;
+                laneHeaps[lane][laneSizes[lane]] = i;
+                SiftUp(laneHeaps[lane], laneSizes[lane]);
+                laneSizes[lane]++;
+            }
+        }
+        isLaneStarted[lane] = true;
+    }
+
+    void Fire(CanHeartbeat& heartbeat, unsigned long currentTime)
+    {
+        const uint16_t period = heartbeat.Handler->GetProcessInterval();
+        const unsigned long lateness = currentTime - heartbeat.Deadline;
+
+        // keep the phase even if whole periods were missed
+        const uint32_t elapsedPeriods = lateness / period + 1;
+        heartbeat.Deadline += elapsedPeriods * period;
+
+        if (!heartbeat.Handler->IsProcessed(currentTime, PROCESS_TIMEOUT))
+        {
+            return;
+        }
+
+        if (elapsedPeriods > 1)
+        {
+            heartbeat.MissedCount++;
+        }
+        heartbeat.LatenessSum += lateness;
+        if (lateness > heartbeat.MaxLateness)
+        {
+            heartbeat.MaxLateness = lateness > UINT16_MAX ? UINT16_MAX : lateness;
+        }
+
+        if (heartbeat.SentCount > 0)
+        {
+            const unsigned long interval = currentTime - heartbeat.PreviousSendTime;
+            const unsigned long jitter = interval > period ? interval - period : period - interval;
+            if (jitter > heartbeat.MaxJitter)
+            {
+                heartbeat.MaxJitter = jitter > UINT16_MAX ? UINT16_MAX : jitter;
+            }
+        }
+        heartbeat.PreviousSendTime = currentTime;
+        heartbeat.SentCount++;
+
+        heartbeat.Handler->SendHeartbeat(currentTime);
+    }
+
+public:
+    CanHeartbeatScheduler()
+    {
+        for (uint8_t i = 0; i < MAX_LANE_COUNT; i++)
+        {
+            laneSizes[i] = 0;
+            isLaneStarted[i] = false;
+        }
+    }
+
+    /* Adds a handler to a lane, has to be called before the task of the lane starts */
+    bool Register(CanMessageHandlerBase* handler, uint8_t lane)
+    {
+        if (heartbeatCount == MAX_HANDLER_COUNT || lane >= MAX_LANE_COUNT)
+        {
+            return false;
+        }
+
+        CanHeartbeat& heartbeat = heartbeats[heartbeatCount];
+        memset(&heartbeat, 0, sizeof(CanHeartbeat));
+        heartbeat.Handler = handler;
+        heartbeat.Lane = lane;
+        heartbeat.PhaseOffset = (heartbeatCount * PHASE_STEP) % handler->GetProcessInterval();
+        heartbeatCount++;
+        return true;
+    }
+
+    /* Sends the heartbeats of the lane which are due, called by the task of the lane */
+    void Process(uint8_t lane, unsigned long currentTime)
+    {
+        if (!isLaneStarted[lane])
+        {
+            StartLane(lane, currentTime);
+        }
+
+        uint8_t* heap = laneHeaps[lane];
+        while (laneSizes[lane] > 0 && (long)(currentTime - heartbeats[heap[0]].Deadline) >= 0)
+        {
+            // the deadline only moves forward, the heartbeat is sifted down to its new place
+            Fire(heartbeats[heap[0]], currentTime);
+            SiftDown(heap, laneSizes[lane], 0);
+        }
+    }
+
+    /* Returns false if the lane has no heartbeats (or did not start yet) */
+    bool GetNextDeadline(uint8_t lane, unsigned long& deadline)
+    {
+        if (laneSizes[lane] == 0)
+        {
+            return false;
+        }
+        deadline = heartbeats[laneHeaps[lane][0]].Deadline;
+        return true;
+    }
+
+    /* Prints one line per message: id, lane, period, phase, sent, missed, average and max lateness, max jitter (ms) */
+    void Print(AbsSer* serialPort)
+    {
+        serialPort->println("id lane period phase sent missed avg max jitter");
+
+        for (uint8_t i = 0; i < heartbeatCount; i++)
+        {
+            const CanHeartbeat& heartbeat = heartbeats[i];
+
+            serialPort->print(heartbeat.Handler->GetCanId(), HEX);
+            serialPort->print(" ");
+            serialPort->print(heartbeat.Lane);
+            serialPort->print(" ");
+            serialPort->print(heartbeat.Handler->GetProcessInterval());
+            serialPort->print(" ");
+            serialPort->print(heartbeat.PhaseOffset);
+            serialPort->print(" ");
+            serialPort->print(heartbeat.SentCount);
+            serialPort->print(" ");
+            serialPort->print(heartbeat.MissedCount);
+            serialPort->print(" ");
+            serialPort->print(heartbeat.SentCount > 0 ? heartbeat.LatenessSum / heartbeat.SentCount : 0);
+            serialPort->print(" ");
+            serialPort->print(heartbeat.MaxLateness);
+            serialPort->print(" ");
+            serialPort->println(heartbeat.MaxJitter);
+        }
+    }
+
+    const CanHeartbeat* GetHeartbeat(CanMessageHandlerBase* handler)
+    {
+        for (uint8_t i = 0; i < heartbeatCount; i++)
+        {
+            if (heartbeats[i].Handler == handler)
+            {
+                return &heartbeats[i];
+            }
+        }
+        return nullptr;
+    }
+};
+
+#endif
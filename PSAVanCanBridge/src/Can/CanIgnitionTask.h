@@ -6,22 +6,29 @@
 #include "Handlers/ICanDisplayPopupHandler.h"
 #include "../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../Helpers/VanVinToBridgeToCan.h"
+#include "../Helpers/SignalBus.h"
+#include "../Helpers/BridgeEventQueue.h"
 
 class CanIgnitionTask {
+    // the parking aid distances are used only if the parking aid answered in this time
+    const static uint16_t PARKING_AID_DATA_TIMEOUT = 3000;
+
     uint8_t brightness = 15;
     int8_t externalTemperature = 0;
 
     bool reverseEngaged = false;
+    // starts as on, so the handlers get a clean state if the bridge boots with the ignition off
+    bool ignitionOn = true;
     bool SendNoRadioButtonMessage = true;
 
     CanIgnitionPacketSender* _radioIgnition;
     CanDashIgnitionPacketSender* _dashIgnition;
     CanParkingAidHandler* _canParkingAid;
-    CanRadioRemoteMessageHandler* _canRadioRemoteMessageHandler;
-    CanStatusOfFunctionsHandler* _canStatusOfFunctionsHandler;
     ICanDisplayPopupHandler* _canPopupHandler;
-    CanWarningLogHandler* _canWarningLogHandler;
     CanVinHandler* _canVinHandler;
+    BridgeEventQueue* _events;
+
+    SignalSubscription<4> parkingAidSignals;
 
 public:
 
@@ -29,34 +36,37 @@ class CanIgnitionTask {
         CanIgnitionPacketSender* radioIgnition,
         CanDashIgnitionPacketSender* dashIgnition,
         CanParkingAidHandler* canParkingAid,
-        CanRadioRemoteMessageHandler* canRadioRemoteMessageHandler,
-        CanStatusOfFunctionsHandler* canStatusOfFunctionsHandler,
         ICanDisplayPopupHandler* canPopupHandler,
-        CanWarningLogHandler* canWarningLogHandler,
-        CanVinHandler* canVinHandler
-    )
+        CanVinHandler* canVinHandler,
+        BridgeEventQueue* eventQueue,
+        const SignalBus* signalBus
+    ) : parkingAidSignals(signalBus, {
+            SIGNAL_PARKING_AID_EXTERIOR_REAR_LEFT_DISTANCE,
+            SIGNAL_PARKING_AID_EXTERIOR_REAR_RIGHT_DISTANCE,
+            SIGNAL_PARKING_AID_INTERIOR_REAR_LEFT_DISTANCE,
+            SIGNAL_PARKING_AID_INTERIOR_REAR_RIGHT_DISTANCE
+        })
     {
         _radioIgnition = radioIgnition;
         _dashIgnition = dashIgnition;
         _canParkingAid = canParkingAid;
-        _canRadioRemoteMessageHandler = canRadioRemoteMessageHandler;
-        _canStatusOfFunctionsHandler = canStatusOfFunctionsHandler;
         _canPopupHandler = canPopupHandler;
-        _canWarningLogHandler = canWarningLogHandler;
         _canVinHandler = canVinHandler;
+        _events = eventQueue;
     }
 
-    void SendIgnition(VanIgnitionDataToBridgeToCan dataToBridge, VanVinToBridgeToCan vinDataToBridge, unsigned long currentTime) {
+    void SendIgnition(const VanIgnitionDataToBridgeToCan& dataToBridge, const VanVinToBridgeToCan& vinDataToBridge, unsigned long currentTime) {
         if (dataToBridge.Ignition == 0)
         {
             // we reset these when the ignition is switched off to get a clean state
             SendNoRadioButtonMessage = true;
-            _canRadioRemoteMessageHandler->IsAndroidInstalled(true);
-
-            _canPopupHandler->Reset();
-            _canStatusOfFunctionsHandler->Reset();
-            _canWarningLogHandler->Reset();
+            // the handlers are reset by the CAN data task which owns them, once when the ignition goes off
+            if (ignitionOn)
+            {
+                _events->Push(BRIDGE_EVENT_IGNITION_OFF);
+            }
         }
+        ignitionOn = dataToBridge.Ignition != 0;
 
         if (dataToBridge.DashboardLightingEnabled || dataToBridge.LowBeamOn)
         {
@@ -100,12 +110,14 @@ class CanIgnitionTask {
         {
             if (!_canPopupHandler->IsPopupVisible())
             {
-                CanDisplayPopupItem item;
-                item.Category = CAN_POPUP_MSG_SHOW_CATEGORY1;
-                item.MessageType = CAN_POPUP_MSG_RISK_OF_ICE;
-                item.DoorStatus1 = 0;
-                item.DoorStatus2 = 0;
-                _canPopupHandler->QueueNewMessage(item);
+                BridgeEvent event;
+                event.Type = BRIDGE_EVENT_POPUP_RAISED;
+                event.Popup.Category = CAN_POPUP_MSG_SHOW_CATEGORY1;
+                event.Popup.MessageType = CAN_POPUP_MSG_RISK_OF_ICE;
+                event.Popup.DoorStatus1 = 0;
+                event.Popup.DoorStatus2 = 0;
+                event.Popup.VANByte = 0;
+                _events->Push(event);
             }
         }
 
@@ -125,15 +137,21 @@ class CanIgnitionTask {
         #pragma region Parking aid
         reverseEngaged = dataToBridge.IsReverseEngaged;
 
-        if (dataToBridge.IsReverseEngaged && dataToBridge.HaveDataFromParkingAid == 1)
+        parkingAidSignals.Update();
+
+        if (dataToBridge.IsReverseEngaged && parkingAidSignals.IsFresh(currentTime, PARKING_AID_DATA_TIMEOUT))
         {
-            _canParkingAid->SetData(dataToBridge.IsReverseEngaged, dataToBridge.IsTrailerPresent, dataToBridge.ExteriorRearLeftDistanceInCm, dataToBridge.ExteriorRearRightDistanceInCm, dataToBridge.InteriorRearLeftDistanceInCm, dataToBridge.InteriorRearRightDistanceInCm, currentTime);
+            _canParkingAid->SetData(
+                dataToBridge.IsReverseEngaged,
+                dataToBridge.IsTrailerPresent,
+                parkingAidSignals.GetValue(0),
+                parkingAidSignals.GetValue(1),
+                parkingAidSignals.GetValue(2),
+                parkingAidSignals.GetValue(3),
+                currentTime);
             _canParkingAid->Process(currentTime);
         }
         #pragma endregion
-
-        _canStatusOfFunctionsHandler->Init();
-        _canWarningLogHandler->Init();
     }
  };
 
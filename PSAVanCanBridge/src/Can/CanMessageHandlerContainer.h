@@ -12,6 +12,9 @@
 
 class CanMessageHandlerContainer {
     const static uint8_t CAN_MESSAGE_HANDLER_COUNT = 2;
+
+    CanRadioRd4DiagHandler radioRd4DiagHandler;
+    CanPinConfigHandler pinConfigHandler;
     AbstractCanMessageHandler* canMessageHandlers[CAN_MESSAGE_HANDLER_COUNT];
 
     public:
@@ -19,9 +22,12 @@ class CanMessageHandlerContainer {
         AbstractCanMessageSender* canInterface,
         AbsSer* serialPort,
         IVinFlashStorage* vinFlashStorage
-    ) {
-        canMessageHandlers[0] = new CanRadioRd4DiagHandler(canInterface, serialPort, vinFlashStorage);
-        canMessageHandlers[1] = new CanPinConfigHandler(canInterface, static_cast<CanRadioRd4DiagHandler*>(canMessageHandlers[0]));
+    ) :
+        radioRd4DiagHandler(canInterface, serialPort, vinFlashStorage),
+        pinConfigHandler(canInterface, &radioRd4DiagHandler)
+    {
+        canMessageHandlers[0] = &radioRd4DiagHandler;
+        canMessageHandlers[1] = &pinConfigHandler;
     }
 
     bool ProcessMessage(
@@ -85,17 +85,17 @@ uint8_t CanMessageSenderEsp32Idf::SendMessage(uint16_t canId, uint8_t ext, uint8
         }
     }
 
-    uint8_t result = -1;
+    uint8_t result = CAN_SEND_FAILED;
 
     if (xSemaphoreTake(canSemaphore, portMAX_DELAY) == pdTRUE)
     {
         if (twai_transmit(&message, pdMS_TO_TICKS(10)) == ESP_OK) {
             //_serialPort->println("Message queued for transmission");
-            result = 0;
+            result = CAN_SEND_OK;
         } else {
             //_serialPort->println("Failed to queue message for transmission");
             //return -1;
-            result = -1;
+            result = CAN_SEND_FAILED;
         }
         xSemaphoreGive(canSemaphore);
     }
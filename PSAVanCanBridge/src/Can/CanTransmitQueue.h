@@ -0,0 +1,204 @@
+// CanTransmitQueue.h
+#pragma once
+
+#ifndef _CanTransmitQueue_h
+    #define _CanTransmitQueue_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WProgram.h"
+#endif
+
+#include <atomic>
+
+#include "AbstractCanMessageSender.h"
+#include "Structs/CanIgnitionStructs.h"
+#include "Structs/CanDash1Structs.h"
+#include "Structs/CanDash2Structs.h"
+#include "Structs/CanDash3Structs.h"
+#include "Structs/CanParkingAidStructs.h"
+#include "Structs/CanTrip0Structs.h"
+#include "Structs/CanTrip1Structs.h"
+#include "Structs/CanTrip2Structs.h"
+#include "Structs/CanVinStructs.h"
+#include "Structs/CanStatusOfFunctionsStructs.h"
+#include "Structs/CanWarningLogStructs.h"
+#include "../SerialPort/AbstractSerial.h"
+
+enum CanTransmitPriority {
+    CAN_TRANSMIT_PRIORITY_HIGH = 0,
+    CAN_TRANSMIT_PRIORITY_NORMAL = 1,
+    CAN_TRANSMIT_PRIORITY_LOW = 2,
+    CAN_TRANSMIT_PRIORITY_COUNT = 3
+};
+
+struct CanTransmitMessage {
+    uint16_t CanId;
+    uint8_t Ext;
+    uint8_t Length;
+    uint8_t Data[8];
+};
+
+/*
+    Makes a single task the owner of the CAN transmitter.
+    The handlers send through this class like through any other sender, but SendMessage() only copies the message into
+    the queue of its priority and never waits: if that queue is full the message is dropped and counted.
+    The transmit task calls WaitForMessages() and TransmitMessages(), which always sends the highest priority message first.
+    Receiving is passed straight to the wrapped sender.
+*/
+class CanTransmitQueue : public AbstractCanMessageSender
+{
+    const static uint8_t QUEUE_LENGTH = 16;
+
+    AbstractCanMessageSender* _canMessageSender;
+    TaskHandle_t _transmitTask = nullptr;
+
+    QueueHandle_t queues[CAN_TRANSMIT_PRIORITY_COUNT];
+
+    std::atomic<uint32_t> queuedCount[CAN_TRANSMIT_PRIORITY_COUNT];
+    std::atomic<uint32_t> droppedCount[CAN_TRANSMIT_PRIORITY_COUNT];
+    std::atomic<uint8_t> highWaterMark[CAN_TRANSMIT_PRIORITY_COUNT];
+    // only the transmit task writes these
+    uint32_t failedCount[CAN_TRANSMIT_PRIORITY_COUNT];
+
+    static CanTransmitPriority GetPriority(uint16_t canId)
+    {
+        switch (canId)
+        {
+            // frames the driver relies on: ignition, lights, warning lights, parking aid
+            case CAN_ID_IGNITION:
+            case CAN_ID_DASH1:
+            case CAN_ID_DASH2:
+            case CAN_ID_DASH3:
+            case CAN_ID_PARKING_AID:
+                return CAN_TRANSMIT_PRIORITY_HIGH;
+
+            // information which is fine to arrive a few cycles later
+            case CAN_ID_TRIP0:
+            case CAN_ID_TRIP1:
+            case CAN_ID_TRIP2:
+            case CAN_ID_VIN_PART1:
+            case CAN_ID_VIN_PART2:
+            case CAN_ID_VIN_PART3:
+            case CAN_ID_STATUS_OF_FUNCTIONS:
+            case CAN_ID_WARNING_LOG:
+                return CAN_TRANSMIT_PRIORITY_LOW;
+
+            default:
+                return CAN_TRANSMIT_PRIORITY_NORMAL;
+        }
+    }
+
+public:
+    CanTransmitQueue(AbstractCanMessageSender* canMessageSender)
+    {
+        _canMessageSender = canMessageSender;
+
+        for (uint8_t i = 0; i < CAN_TRANSMIT_PRIORITY_COUNT; i++)
+        {
+            queues[i] = xQueueCreate(QUEUE_LENGTH, sizeof(CanTransmitMessage));
+            queuedCount[i] = 0;
+            droppedCount[i] = 0;
+            failedCount[i] = 0;
+            highWaterMark[i] = 0;
+        }
+    }
+
+    /* The task calling TransmitMessages(), it is notified when a message is queued */
+    void SetTransmitTask(TaskHandle_t transmitTask)
+    {
+        _transmitTask = transmitTask;
+    }
+
+    void Init() override
+    {
+        _canMessageSender->Init();
+    }
+
+    /* Returns CAN_SEND_OK if the message was queued, CAN_SEND_FAILED if its queue was full */
+    uint8_t SendMessage(uint16_t canId, uint8_t ext, uint8_t sizeOfByteArray, uint8_t *byteArray) override
+    {
+        CanTransmitMessage message;
+        message.CanId = canId;
+        message.Ext = ext;
+        message.Length = sizeOfByteArray < sizeof(message.Data) ? sizeOfByteArray : sizeof(message.Data);
+        memcpy(message.Data, byteArray, message.Length);
+
+        const CanTransmitPriority priority = GetPriority(canId);
+        if (xQueueSend(queues[priority], &message, 0) != pdTRUE)
+        {
+            droppedCount[priority].fetch_add(1, std::memory_order_relaxed);
+            return CAN_SEND_FAILED;
+        }
+        queuedCount[priority].fetch_add(1, std::memory_order_relaxed);
+
+        // measured right after the enqueue, the transmit task may empty the queue before it would see this depth
+        const uint8_t waiting = uxQueueMessagesWaiting(queues[priority]);
+        uint8_t highest = highWaterMark[priority].load(std::memory_order_relaxed);
+        while (waiting > highest && !highWaterMark[priority].compare_exchange_weak(highest, waiting, std::memory_order_relaxed))
+        {
+        }
+
+        if (_transmitTask != nullptr)
+        {
+            xTaskNotifyGive(_transmitTask);
+        }
+        return CAN_SEND_OK;
+    }
+
+    void ReadMessage(uint16_t *canId, uint8_t *len, uint8_t *buf) override
+    {
+        _canMessageSender->ReadMessage(canId, len, buf);
+    }
+
+    /* Waits up to maxWait until a message is queued. Only the transmit task may call it. */
+    void WaitForMessages(TickType_t maxWait)
+    {
+        ulTaskNotifyTake(pdTRUE, maxWait);
+    }
+
+    /* Sends everything queued, highest priority first. Only the transmit task may call it. */
+    void TransmitMessages()
+    {
+        CanTransmitMessage message;
+        uint8_t priority = 0;
+        while (priority < CAN_TRANSMIT_PRIORITY_COUNT)
+        {
+            if (xQueueReceive(queues[priority], &message, 0) != pdTRUE)
+            {
+                priority++;
+                continue;
+            }
+
+            if (_canMessageSender->SendMessage(message.CanId, message.Ext, message.Length, message.Data) != CAN_SEND_OK)
+            {
+                failedCount[priority]++;
+            }
+
+            // a higher priority message may have arrived while this one was sent
+            priority = 0;
+        }
+    }
+
+    /* Prints one line per priority: queued, dropped because the queue was full, failed to transmit, queue high water mark */
+    void Print(AbsSer* serialPort)
+    {
+        serialPort->println("priority queued dropped failed max");
+
+        for (uint8_t i = 0; i < CAN_TRANSMIT_PRIORITY_COUNT; i++)
+        {
+            serialPort->print(i);
+            serialPort->print(" ");
+            serialPort->print(queuedCount[i].load(std::memory_order_relaxed));
+            serialPort->print(" ");
+            serialPort->print(droppedCount[i].load(std::memory_order_relaxed));
+            serialPort->print(" ");
+            serialPort->print(failedCount[i]);
+            serialPort->print(" ");
+            serialPort->println(highWaterMark[i].load(std::memory_order_relaxed));
+        }
+    }
+};
+
+#endif
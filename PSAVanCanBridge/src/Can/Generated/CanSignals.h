@@ -0,0 +1,616 @@
+// CanSignals.h
+// Generated by tools/generate_signals.py from schema/signals.json, do not edit by hand
+#pragma once
+
+#ifndef _CanSignals_h
+    #define _CanSignals_h
+
+#include <stdint.h>
+
+#include "../../Helpers/BitField.h"
+
+// CAN 0x0B6
+struct CanSpeedAndRpmSignals {
+    const static uint16_t ID = 0x0B6;
+    const static uint8_t LENGTH = 8;
+    // transmit period in milliseconds
+    const static uint16_t PERIOD = 40;
+
+    // Rpm: bytes 0-1 big endian, value = raw / 8
+    typedef BitField<0, 0, 16, BIT_FIELD_BIG_ENDIAN> RpmField;
+
+    static uint16_t GetRpmRaw(const uint8_t data[])
+    {
+        return RpmField::Get(data);
+    }
+
+    static void SetRpmRaw(uint8_t data[], uint16_t raw)
+    {
+        RpmField::Set(data, raw);
+    }
+
+    static uint16_t GetRpm(const uint8_t data[])
+    {
+        const uint16_t raw = GetRpmRaw(data);
+        return (uint16_t)(raw / 8);
+    }
+
+    static void SetRpm(uint8_t data[], uint16_t value)
+    {
+        SetRpmRaw(data, (uint16_t)((int32_t)value * 8));
+    }
+
+    // Speed: bytes 2-3 big endian, value = raw / 100
+    typedef BitField<2, 0, 16, BIT_FIELD_BIG_ENDIAN> SpeedField;
+
+    static uint16_t GetSpeedRaw(const uint8_t data[])
+    {
+        return SpeedField::Get(data);
+    }
+
+    static void SetSpeedRaw(uint8_t data[], uint16_t raw)
+    {
+        SpeedField::Set(data, raw);
+    }
+
+    static uint16_t GetSpeed(const uint8_t data[])
+    {
+        const uint16_t raw = GetSpeedRaw(data);
+        return (uint16_t)(raw / 100);
+    }
+
+    static void SetSpeed(uint8_t data[], uint16_t value)
+    {
+        SetSpeedRaw(data, (uint16_t)((int32_t)value * 100));
+    }
+
+    // Odometer: bytes 4-5 little endian
+    typedef BitField<4, 0, 16, BIT_FIELD_LITTLE_ENDIAN> OdometerField;
+
+    static uint16_t GetOdometer(const uint8_t data[])
+    {
+        return OdometerField::Get(data);
+    }
+
+    static void SetOdometer(uint8_t data[], uint16_t raw)
+    {
+        OdometerField::Set(data, raw);
+    }
+
+    // FuelConsumptionCounter: byte 6
+    typedef BitField<6, 0, 8> FuelConsumptionCounterField;
+
+    static uint8_t GetFuelConsumptionCounter(const uint8_t data[])
+    {
+        return FuelConsumptionCounterField::Get(data);
+    }
+
+    static void SetFuelConsumptionCounter(uint8_t data[], uint8_t raw)
+    {
+        FuelConsumptionCounterField::Set(data, raw);
+    }
+
+    // Field4: byte 7
+    typedef BitField<7, 0, 8> Field4Field;
+
+    static uint8_t GetField4(const uint8_t data[])
+    {
+        return Field4Field::Get(data);
+    }
+
+    static void SetField4(uint8_t data[], uint8_t raw)
+    {
+        Field4Field::Set(data, raw);
+    }
+};
+
+// CAN 0x221
+struct CanTrip0Signals {
+    const static uint16_t ID = 0x221;
+    const static uint8_t LENGTH = 7;
+    // transmit period in milliseconds
+    const static uint16_t PERIOD = 333;
+
+    // TripSwitchPressed: byte 0 bit 3
+    typedef BitField<0, 3, 1> TripSwitchPressedField;
+
+    static uint8_t GetTripSwitchPressed(const uint8_t data[])
+    {
+        return TripSwitchPressedField::Get(data);
+    }
+
+    static void SetTripSwitchPressed(uint8_t data[], uint8_t raw)
+    {
+        TripSwitchPressedField::Set(data, raw);
+    }
+
+    // RestOfRunIsNull: byte 0 bit 6
+    typedef BitField<0, 6, 1> RestOfRunIsNullField;
+
+    static uint8_t GetRestOfRunIsNull(const uint8_t data[])
+    {
+        return RestOfRunIsNullField::Get(data);
+    }
+
+    static void SetRestOfRunIsNull(uint8_t data[], uint8_t raw)
+    {
+        RestOfRunIsNullField::Set(data, raw);
+    }
+
+    // LitersPer100KmIsNull: byte 0 bit 7
+    typedef BitField<0, 7, 1> LitersPer100KmIsNullField;
+
+    static uint8_t GetLitersPer100KmIsNull(const uint8_t data[])
+    {
+        return LitersPer100KmIsNullField::Get(data);
+    }
+
+    static void SetLitersPer100KmIsNull(uint8_t data[], uint8_t raw)
+    {
+        LitersPer100KmIsNullField::Set(data, raw);
+    }
+
+    // LitersPer100Km: bytes 1-2 big endian
+    typedef BitField<1, 0, 16, BIT_FIELD_BIG_ENDIAN> LitersPer100KmField;
+
+    static uint16_t GetLitersPer100Km(const uint8_t data[])
+    {
+        return LitersPer100KmField::Get(data);
+    }
+
+    static void SetLitersPer100Km(uint8_t data[], uint16_t raw)
+    {
+        LitersPer100KmField::Set(data, raw);
+    }
+
+    // KmToGasStation: bytes 3-4 big endian
+    typedef BitField<3, 0, 16, BIT_FIELD_BIG_ENDIAN> KmToGasStationField;
+
+    static uint16_t GetKmToGasStation(const uint8_t data[])
+    {
+        return KmToGasStationField::Get(data);
+    }
+
+    static void SetKmToGasStation(uint8_t data[], uint16_t raw)
+    {
+        KmToGasStationField::Set(data, raw);
+    }
+
+    // KmToFinish: bytes 5-6 big endian, value = raw / 10
+    typedef BitField<5, 0, 16, BIT_FIELD_BIG_ENDIAN> KmToFinishField;
+
+    static uint16_t GetKmToFinishRaw(const uint8_t data[])
+    {
+        return KmToFinishField::Get(data);
+    }
+
+    static void SetKmToFinishRaw(uint8_t data[], uint16_t raw)
+    {
+        KmToFinishField::Set(data, raw);
+    }
+
+    static uint16_t GetKmToFinish(const uint8_t data[])
+    {
+        const uint16_t raw = GetKmToFinishRaw(data);
+        return (uint16_t)(raw / 10);
+    }
+
+    static void SetKmToFinish(uint8_t data[], uint16_t value)
+    {
+        SetKmToFinishRaw(data, (uint16_t)((int32_t)value * 10));
+    }
+};
+
+// CAN 0x1A1
+struct CanDisplayPopupSignals {
+    const static uint16_t ID = 0x1A1;
+    const static uint8_t LENGTH = 8;
+
+    // Category: byte 0
+    typedef BitField<0, 0, 8> CategoryField;
+
+    static uint8_t GetCategory(const uint8_t data[])
+    {
+        return CategoryField::Get(data);
+    }
+
+    static void SetCategory(uint8_t data[], uint8_t raw)
+    {
+        CategoryField::Set(data, raw);
+    }
+
+    // MessageType: byte 1
+    typedef BitField<1, 0, 8> MessageTypeField;
+
+    static uint8_t GetMessageType(const uint8_t data[])
+    {
+        return MessageTypeField::Get(data);
+    }
+
+    static void SetMessageType(uint8_t data[], uint8_t raw)
+    {
+        MessageTypeField::Set(data, raw);
+    }
+
+    // ShowPopup: byte 2 bit 7
+    typedef BitField<2, 7, 1> ShowPopupField;
+
+    static uint8_t GetShowPopup(const uint8_t data[])
+    {
+        return ShowPopupField::Get(data);
+    }
+
+    static void SetShowPopup(uint8_t data[], uint8_t raw)
+    {
+        ShowPopupField::Set(data, raw);
+    }
+
+    // DoorStatus1: byte 3
+    typedef BitField<3, 0, 8> DoorStatus1Field;
+
+    static uint8_t GetDoorStatus1(const uint8_t data[])
+    {
+        return DoorStatus1Field::Get(data);
+    }
+
+    static void SetDoorStatus1(uint8_t data[], uint8_t raw)
+    {
+        DoorStatus1Field::Set(data, raw);
+    }
+
+    // DoorStatus2: byte 4
+    typedef BitField<4, 0, 8> DoorStatus2Field;
+
+    static uint8_t GetDoorStatus2(const uint8_t data[])
+    {
+        return DoorStatus2Field::Get(data);
+    }
+
+    static void SetDoorStatus2(uint8_t data[], uint8_t raw)
+    {
+        DoorStatus2Field::Set(data, raw);
+    }
+
+    // Km: bytes 6-7 big endian
+    typedef BitField<6, 0, 16, BIT_FIELD_BIG_ENDIAN> KmField;
+
+    static uint16_t GetKm(const uint8_t data[])
+    {
+        return KmField::Get(data);
+    }
+
+    static void SetKm(uint8_t data[], uint16_t raw)
+    {
+        KmField::Set(data, raw);
+    }
+};
+
+// CAN 0x1E3
+struct CanAirConOnDisplaySignals {
+    const static uint16_t ID = 0x1E3;
+    const static uint8_t LENGTH = 7;
+    // transmit period in milliseconds
+    const static uint16_t PERIOD = 10;
+
+    // SeparateSides: byte 0 bit 0
+    typedef BitField<0, 0, 1> SeparateSidesField;
+
+    static uint8_t GetSeparateSides(const uint8_t data[])
+    {
+        return SeparateSidesField::Get(data);
+    }
+
+    static void SetSeparateSides(uint8_t data[], uint8_t raw)
+    {
+        SeparateSidesField::Set(data, raw);
+    }
+
+    // OutsideAir: byte 0 bit 1
+    typedef BitField<0, 1, 1> OutsideAirField;
+
+    static uint8_t GetOutsideAir(const uint8_t data[])
+    {
+        return OutsideAirField::Get(data);
+    }
+
+    static void SetOutsideAir(uint8_t data[], uint8_t raw)
+    {
+        OutsideAirField::Set(data, raw);
+    }
+
+    // AutoMode: byte 0 bit 3
+    typedef BitField<0, 3, 1> AutoModeField;
+
+    static uint8_t GetAutoMode(const uint8_t data[])
+    {
+        return AutoModeField::Get(data);
+    }
+
+    static void SetAutoMode(uint8_t data[], uint8_t raw)
+    {
+        AutoModeField::Set(data, raw);
+    }
+
+    // Off: byte 0 bit 5
+    typedef BitField<0, 5, 1> OffField;
+
+    static uint8_t GetOff(const uint8_t data[])
+    {
+        return OffField::Get(data);
+    }
+
+    static void SetOff(uint8_t data[], uint8_t raw)
+    {
+        OffField::Set(data, raw);
+    }
+
+    // AirConOff: byte 0 bit 6
+    typedef BitField<0, 6, 1> AirConOffField;
+
+    static uint8_t GetAirConOff(const uint8_t data[])
+    {
+        return AirConOffField::Get(data);
+    }
+
+    static void SetAirConOff(uint8_t data[], uint8_t raw)
+    {
+        AirConOffField::Set(data, raw);
+    }
+
+    // CabinAirRecycling: byte 0 bit 7
+    typedef BitField<0, 7, 1> CabinAirRecyclingField;
+
+    static uint8_t GetCabinAirRecycling(const uint8_t data[])
+    {
+        return CabinAirRecyclingField::Get(data);
+    }
+
+    static void SetCabinAirRecycling(uint8_t data[], uint8_t raw)
+    {
+        CabinAirRecyclingField::Set(data, raw);
+    }
+
+    // Windshield: byte 1 bit 7
+    typedef BitField<1, 7, 1> WindshieldField;
+
+    static uint8_t GetWindshield(const uint8_t data[])
+    {
+        return WindshieldField::Get(data);
+    }
+
+    static void SetWindshield(uint8_t data[], uint8_t raw)
+    {
+        WindshieldField::Set(data, raw);
+    }
+
+    // TemperatureLeft: byte 2
+    typedef BitField<2, 0, 8> TemperatureLeftField;
+
+    static uint8_t GetTemperatureLeft(const uint8_t data[])
+    {
+        return TemperatureLeftField::Get(data);
+    }
+
+    static void SetTemperatureLeft(uint8_t data[], uint8_t raw)
+    {
+        TemperatureLeftField::Set(data, raw);
+    }
+
+    // TemperatureRight: byte 3
+    typedef BitField<3, 0, 8> TemperatureRightField;
+
+    static uint8_t GetTemperatureRight(const uint8_t data[])
+    {
+        return TemperatureRightField::Get(data);
+    }
+
+    static void SetTemperatureRight(uint8_t data[], uint8_t raw)
+    {
+        TemperatureRightField::Set(data, raw);
+    }
+
+    // AirDirectionLeft: byte 4
+    typedef BitField<4, 0, 8> AirDirectionLeftField;
+
+    static uint8_t GetAirDirectionLeft(const uint8_t data[])
+    {
+        return AirDirectionLeftField::Get(data);
+    }
+
+    static void SetAirDirectionLeft(uint8_t data[], uint8_t raw)
+    {
+        AirDirectionLeftField::Set(data, raw);
+    }
+
+    // AirDirectionRight: byte 5
+    typedef BitField<5, 0, 8> AirDirectionRightField;
+
+    static uint8_t GetAirDirectionRight(const uint8_t data[])
+    {
+        return AirDirectionRightField::Get(data);
+    }
+
+    static void SetAirDirectionRight(uint8_t data[], uint8_t raw)
+    {
+        AirDirectionRightField::Set(data, raw);
+    }
+
+    // FanSpeed: byte 6
+    typedef BitField<6, 0, 8> FanSpeedField;
+
+    static uint8_t GetFanSpeed(const uint8_t data[])
+    {
+        return FanSpeedField::Get(data);
+    }
+
+    static void SetFanSpeed(uint8_t data[], uint8_t raw)
+    {
+        FanSpeedField::Set(data, raw);
+    }
+};
+
+// CAN 0x0E1
+struct CanParkingAidSignals {
+    const static uint16_t ID = 0x0E1;
+    const static uint8_t LENGTH = 8;
+    // transmit period in milliseconds
+    const static uint16_t PERIOD = 10;
+
+    // SoundEnabled: byte 1 bit 4
+    typedef BitField<1, 4, 1> SoundEnabledField;
+
+    static uint8_t GetSoundEnabled(const uint8_t data[])
+    {
+        return SoundEnabledField::Get(data);
+    }
+
+    static void SetSoundEnabled(uint8_t data[], uint8_t raw)
+    {
+        SoundEnabledField::Set(data, raw);
+    }
+
+    // FrontChannel: byte 1 bit 5
+    typedef BitField<1, 5, 1> FrontChannelField;
+
+    static uint8_t GetFrontChannel(const uint8_t data[])
+    {
+        return FrontChannelField::Get(data);
+    }
+
+    static void SetFrontChannel(uint8_t data[], uint8_t raw)
+    {
+        FrontChannelField::Set(data, raw);
+    }
+
+    // LeftChannelSound: byte 1 bit 6
+    typedef BitField<1, 6, 1> LeftChannelSoundField;
+
+    static uint8_t GetLeftChannelSound(const uint8_t data[])
+    {
+        return LeftChannelSoundField::Get(data);
+    }
+
+    static void SetLeftChannelSound(uint8_t data[], uint8_t raw)
+    {
+        LeftChannelSoundField::Set(data, raw);
+    }
+
+    // RightChannelSound: byte 1 bit 7
+    typedef BitField<1, 7, 1> RightChannelSoundField;
+
+    static uint8_t GetRightChannelSound(const uint8_t data[])
+    {
+        return RightChannelSoundField::Get(data);
+    }
+
+    static void SetRightChannelSound(uint8_t data[], uint8_t raw)
+    {
+        RightChannelSoundField::Set(data, raw);
+    }
+
+    // BeepPeriod: byte 2 bits 0-5
+    typedef BitField<2, 0, 6> BeepPeriodField;
+
+    static uint8_t GetBeepPeriod(const uint8_t data[])
+    {
+        return BeepPeriodField::Get(data);
+    }
+
+    static void SetBeepPeriod(uint8_t data[], uint8_t raw)
+    {
+        BeepPeriodField::Set(data, raw);
+    }
+
+    // Rear: byte 3 bits 2-4
+    typedef BitField<3, 2, 3> RearField;
+
+    static uint8_t GetRear(const uint8_t data[])
+    {
+        return RearField::Get(data);
+    }
+
+    static void SetRear(uint8_t data[], uint8_t raw)
+    {
+        RearField::Set(data, raw);
+    }
+
+    // RearLeft: byte 3 bits 5-7
+    typedef BitField<3, 5, 3> RearLeftField;
+
+    static uint8_t GetRearLeft(const uint8_t data[])
+    {
+        return RearLeftField::Get(data);
+    }
+
+    static void SetRearLeft(uint8_t data[], uint8_t raw)
+    {
+        RearLeftField::Set(data, raw);
+    }
+
+    // FrontLeft: byte 4 bits 2-4
+    typedef BitField<4, 2, 3> FrontLeftField;
+
+    static uint8_t GetFrontLeft(const uint8_t data[])
+    {
+        return FrontLeftField::Get(data);
+    }
+
+    static void SetFrontLeft(uint8_t data[], uint8_t raw)
+    {
+        FrontLeftField::Set(data, raw);
+    }
+
+    // RearRight: byte 4 bits 5-7
+    typedef BitField<4, 5, 3> RearRightField;
+
+    static uint8_t GetRearRight(const uint8_t data[])
+    {
+        return RearRightField::Get(data);
+    }
+
+    static void SetRearRight(uint8_t data[], uint8_t raw)
+    {
+        RearRightField::Set(data, raw);
+    }
+
+    // Show: byte 5 bit 1
+    typedef BitField<5, 1, 1> ShowField;
+
+    static uint8_t GetShow(const uint8_t data[])
+    {
+        return ShowField::Get(data);
+    }
+
+    static void SetShow(uint8_t data[], uint8_t raw)
+    {
+        ShowField::Set(data, raw);
+    }
+
+    // FrontRight: byte 5 bits 2-4
+    typedef BitField<5, 2, 3> FrontRightField;
+
+    static uint8_t GetFrontRight(const uint8_t data[])
+    {
+        return FrontRightField::Get(data);
+    }
+
+    static void SetFrontRight(uint8_t data[], uint8_t raw)
+    {
+        FrontRightField::Set(data, raw);
+    }
+
+    // Front: byte 5 bits 5-7
+    typedef BitField<5, 5, 3> FrontField;
+
+    static uint8_t GetFront(const uint8_t data[])
+    {
+        return FrontField::Get(data);
+    }
+
+    static void SetFront(uint8_t data[], uint8_t raw)
+    {
+        FrontField::Set(data, raw);
+    }
+};
+
+#endif
@@ -29,13 +29,13 @@ class CanAirConOnDisplayHandler : public CanMessageHandlerBase
 
     bool sendMessageOnCan;
 
-    CanAirConditionOnDisplayPacketSender* acSender;
+    CanAirConditionOnDisplayPacketSender acSender;
 
     virtual void InternalProcess()
     {
         if (sendMessageOnCan)
         {
-            acSender->SendACDataToDisplay(
+            acSender.SendACDataToDisplay(
                 prevTemperatureLeft,
                 prevTemperatureRight,
                 prevDirection,
@@ -50,9 +50,8 @@ class CanAirConOnDisplayHandler : public CanMessageHandlerBase
     }
 
 public:
-    CanAirConOnDisplayHandler(AbstractCanMessageSender* object) : CanMessageHandlerBase(object, CAN_AIRCON_INTERVAL)
+    CanAirConOnDisplayHandler(AbstractCanMessageSender* object) : CanMessageHandlerBase(object, CAN_ID_AIRCON_ON_DIPSLAY, CAN_AIRCON_INTERVAL), acSender(object)
     {
-        acSender = new CanAirConditionOnDisplayPacketSender(object);
         FanSpeedChangedCounter = 0;
     }
 
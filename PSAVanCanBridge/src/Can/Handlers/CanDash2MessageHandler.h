@@ -13,20 +13,21 @@
 
 class CanDash2MessageHandler : public CanMessageHandlerBase
 {
-    CanDash2PacketSender* Dash2Sender;
+    // light and gear changes are sent at once, but not more often than this
+    static const uint8_t CAN_DASH2_MIN_INTERVAL = 20;
 
-    uint8_t _ignition;
+    CanDash2PacketSender Dash2Sender;
+
+    uint8_t _ignition = 0;
     LightStatus _lightStatus;
     DashIcons1 _dashIcons1;
-    uint8_t _gearboxMode;
-    uint8_t _gearboxSelection;
-    uint8_t _gearboxPosition;
-
-    VanCanGearboxPositionMap* _gearboxMap;
+    uint8_t _gearboxMode = 0;
+    uint8_t _gearboxSelection = 0;
+    uint8_t _gearboxPosition = 0;
 
     virtual void InternalProcess()
     {
-        Dash2Sender->SendData(
+        Dash2Sender.SendData(
             _dashIcons1.status.SeatBeltWarning,
             _lightStatus.status.SideLights,
             _lightStatus.status.LowBeam,
@@ -48,10 +49,10 @@ class CanDash2MessageHandler : public CanMessageHandlerBase
     }
 
     public:
-    CanDash2MessageHandler(AbstractCanMessageSender* object) : CanMessageHandlerBase(object, CAN_ID_DASH2_INTERVAL)
+    CanDash2MessageHandler(AbstractCanMessageSender* object) : CanMessageHandlerBase(object, CAN_ID_DASH2, CAN_ID_DASH2_INTERVAL, CAN_DASH2_MIN_INTERVAL), Dash2Sender(object)
     {
-        Dash2Sender = new CanDash2PacketSender(object);
-        _gearboxMap = new VanCanGearboxPositionMap();
+        _lightStatus.asByte = 0;
+        _dashIcons1.asByte = 0;
     }
 
     void SetData(
@@ -63,13 +64,27 @@ class CanDash2MessageHandler : public CanMessageHandlerBase
         uint8_t gearboxPosition
     )
     {
+        gearboxMode = VanCanGearboxPositionMap::GetGearboxModeFromVanMode(gearboxMode);
+        gearboxSelection = VanCanGearboxPositionMap::GetGearboxSelectionFromVanSelection(gearboxSelection);
+        gearboxPosition = VanCanGearboxPositionMap::GetGearboxPositionFromVanPosition(gearboxPosition);
+
+        if (lightStatus.asByte != _lightStatus.asByte ||
+            dashIcons1.asByte != _dashIcons1.asByte ||
+            ignition != _ignition ||
+            gearboxMode != _gearboxMode ||
+            gearboxSelection != _gearboxSelection ||
+            gearboxPosition != _gearboxPosition)
+        {
+            SetDataChanged();
+        }
+
         _lightStatus = lightStatus;
         _dashIcons1 = dashIcons1;
         _ignition = ignition;
 
-        _gearboxMode = _gearboxMap->GetGearboxModeFromVanMode(gearboxMode);
-        _gearboxSelection = _gearboxMap->GetGearboxSelectionFromVanSelection(gearboxSelection);
-        _gearboxPosition = _gearboxMap->GetGearboxPositionFromVanPosition(gearboxPosition);
+        _gearboxMode = gearboxMode;
+        _gearboxSelection = gearboxSelection;
+        _gearboxPosition = gearboxPosition;
     }
 };
 #endif
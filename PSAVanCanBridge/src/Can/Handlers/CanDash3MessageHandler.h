@@ -12,14 +12,16 @@
 class CanDash3MessageHandler : public CanMessageHandlerBase
 {
     static const uint8_t CAN_DASH3_MESSAGE_INTERVAL = 80;
+    // warning lights are sent at once when they change, but not more often than this
+    static const uint8_t CAN_DASH3_MIN_INTERVAL = 20;
 
-    CanDash3PacketSender* Dash3Sender;
+    CanDash3PacketSender Dash3Sender;
 
     DashIcons1 _DashIcons1;
 
     virtual void InternalProcess()
     {
-        Dash3Sender->SendData(
+        Dash3Sender.SendData(
             _DashIcons1.status.Handbrake,
             _DashIcons1.status.Mil,
             _DashIcons1.status.Abs,
@@ -29,15 +31,19 @@ class CanDash3MessageHandler : public CanMessageHandlerBase
     }
 
     public:
-    CanDash3MessageHandler(AbstractCanMessageSender* object) : CanMessageHandlerBase(object, CAN_DASH3_MESSAGE_INTERVAL)
+    CanDash3MessageHandler(AbstractCanMessageSender* object) : CanMessageHandlerBase(object, CAN_ID_DASH3, CAN_DASH3_MESSAGE_INTERVAL, CAN_DASH3_MIN_INTERVAL), Dash3Sender(object)
     {
-        Dash3Sender = new CanDash3PacketSender(object);
+        _DashIcons1.asByte = 0;
     }
 
     void SetData(
         DashIcons1 dashIcons1
     )
     {
+        if (dashIcons1.asByte != _DashIcons1.asByte)
+        {
+            SetDataChanged();
+        }
         _DashIcons1 = dashIcons1;
     }
 };
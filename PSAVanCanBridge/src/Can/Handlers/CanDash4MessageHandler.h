@@ -11,28 +11,33 @@
 class CanDash4MessageHandler : public CanMessageHandlerBase
 {
     static const uint8_t CAN_DASH4_MESSAGE_INTERVAL = 100;
+    // the fuel level and the oil temperature are sent at once when they change, but not more often than this
+    static const uint8_t CAN_DASH4_MIN_INTERVAL = 20;
 
-    CanDash4PacketSender* Dash4Sender;
+    CanDash4PacketSender Dash4Sender;
 
-    uint8_t _fuelLevel;
-    int8_t _oilTemperature;
+    uint8_t _fuelLevel = 0;
+    int8_t _oilTemperature = 0;
 
     virtual void InternalProcess()
     {
-        Dash4Sender->SendData(
+        Dash4Sender.SendData(
             _fuelLevel,
             _oilTemperature
         );
     }
 
     public:
-    CanDash4MessageHandler(AbstractCanMessageSender* object) : CanMessageHandlerBase(object, CAN_DASH4_MESSAGE_INTERVAL)
+    CanDash4MessageHandler(AbstractCanMessageSender* object) : CanMessageHandlerBase(object, CAN_ID_DASH4, CAN_DASH4_MESSAGE_INTERVAL, CAN_DASH4_MIN_INTERVAL), Dash4Sender(object)
     {
-        Dash4Sender = new CanDash4PacketSender(object);
     }
 
     void SetData(uint8_t fuelLevel, int8_t oilTemperature)
     {
+        if (fuelLevel != _fuelLevel || oilTemperature != _oilTemperature)
+        {
+            SetDataChanged();
+        }
         _fuelLevel = fuelLevel;
         _oilTemperature = oilTemperature;
     }
@@ -18,9 +18,13 @@ class CanDisplayPopupHandler : public ICanDisplayPopupHandler
 
     const int CAN_POPUP_INTERVAL = 200;
     const uint8_t CAN_POPUP_MESSAGE_SEND_COUNT = 10;
+    const uint8_t CAN_POPUP_MESSAGE_SEND_INTERVAL = 5;
+    const uint8_t CAN_POPUP_SEQUENCE_LENGTH = 4;
 
     AbstractCanMessageSender *canMessageSender;
-    CanDisplayPacketSender *displayMessageSender;
+    CanFrameSequence popupSequence;
+    CanFrameSequenceWriter popupSequenceWriter;
+    CanDisplayPacketSender displayMessageSender;
 
     //ByteAcceptanceHandler* byteAcceptanceHandler;
 
@@ -36,14 +40,16 @@ class CanDisplayPopupHandler : public ICanDisplayPopupHandler
     SemaphoreHandle_t canSemaphore;
 
     public:
-    CanDisplayPopupHandler(AbstractCanMessageSender * object)
+    CanDisplayPopupHandler(AbstractCanMessageSender * object) :
+        popupSequence(object, CAN_POPUP_SEQUENCE_LENGTH),
+        popupSequenceWriter(&popupSequence, CAN_POPUP_MESSAGE_SEND_COUNT, CAN_POPUP_MESSAGE_SEND_INTERVAL),
+        displayMessageSender(&popupSequenceWriter)
     {
         canMessageSender = object;
         popupMessageQueue = new Queue(sizeof(CanDisplayPopupItem), 10, FIFO); // Instantiate queue for popup messages
         canSemaphore = xSemaphoreCreateMutex();
         lastPopupMessage.IsInited = false;
         //byteAcceptanceHandler = new ByteAcceptanceHandler(2);
-        displayMessageSender = new CanDisplayPacketSender(canMessageSender);
     }
 
     void QueueNewMessage(CanDisplayPopupItem item)
@@ -153,7 +159,6 @@ class CanDisplayPopupHandler : public ICanDisplayPopupHandler
                 {
                     HideCanPopupMessage(lastPopupMessage.MessageType, lastPopupMessage.DoorStatus1, lastPopupMessage.Counter);
                 }
-                vTaskDelay(10 / portTICK_PERIOD_MS);
                 ShowCanPopupMessage(currentPopupMessage.Category, currentPopupMessage.MessageType, currentPopupMessage.KmToDisplay, currentPopupMessage.DoorStatus1, currentPopupMessage.DoorStatus2, currentPopupMessage.Counter);
                 lastPopupMessage.MessageType = currentPopupMessage.MessageType;
                 lastPopupMessage.DisplayTimeInMilliSeconds = currentPopupMessage.DisplayTimeInMilliSeconds;
@@ -166,13 +171,7 @@ class CanDisplayPopupHandler : public ICanDisplayPopupHandler
     }
 
     void ShowCanPopupMessage(uint8_t category, uint8_t messageType, int kmToDisplay, uint8_t doorStatus1, uint8_t doorStatus2, int counter) {
-        uint8_t messageSentCount = 0;
-        while (messageSentCount < CAN_POPUP_MESSAGE_SEND_COUNT)
-        {
-            displayMessageSender->ShowPopup(category, messageType, kmToDisplay, doorStatus1, doorStatus2);
-            messageSentCount++;
-            vTaskDelay(5 / portTICK_PERIOD_MS);
-        }
+        displayMessageSender.ShowPopup(category, messageType, kmToDisplay, doorStatus1, doorStatus2);
         canDisplayPopupStartTime = millis();
         canPopupVisible = true;
         lastPopupMessage.Visible = true;
@@ -189,13 +188,7 @@ class CanDisplayPopupHandler : public ICanDisplayPopupHandler
 
     void HideCanPopupMessage(uint8_t messageType, uint8_t doorStatus, int counter)
     {
-        uint8_t messageSentCount = 0;
-        while (messageSentCount < CAN_POPUP_MESSAGE_SEND_COUNT)
-        {
-            displayMessageSender->HidePopup(messageType);
-            messageSentCount++;
-            vTaskDelay(5 / portTICK_PERIOD_MS);
-        }
+        displayMessageSender.HidePopup(messageType);
         lastPopupMessage.DisplayTimeInMilliSeconds = 0;
         lastPopupMessage.Visible = false;
         canPopupVisible = false;
@@ -243,6 +236,11 @@ class CanDisplayPopupHandler : public ICanDisplayPopupHandler
     void SetIgnition(bool isOn)
     {
     }
+
+    CanFrameSequence* GetFrameSequence()
+    {
+        return &popupSequence;
+    }
 };
 
 #endif
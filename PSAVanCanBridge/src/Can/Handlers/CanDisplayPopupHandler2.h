@@ -12,15 +12,12 @@ class CanDisplayPopupHandler2 : public ICanDisplayPopupHandler
 {
 
 public:
-    CanDisplayPopupHandler2() {
-        canMessageSender = NULL;
-        popupMessageQueue = NULL;
-        canSemaphore = NULL;
-    }
-
-    CanDisplayPopupHandler2(AbstractCanMessageSender* msgSender) {
+    CanDisplayPopupHandler2(AbstractCanMessageSender* msgSender) :
+        popupSequence(msgSender, CAN_POPUP_SEQUENCE_LENGTH),
+        popupSequenceWriter(&popupSequence, CAN_POPUP_MESSAGE_SEND_COUNT, CAN_POPUP_MESSAGE_SEND_INTERVAL),
+        displayMessageSender(&popupSequenceWriter)
+    {
         canMessageSender = msgSender;
-        displayMessageSender = new CanDisplayPacketSender(canMessageSender);
         popupMessageQueue = new Queue(sizeof(CanDisplayPopupItem), 20, FIFO); // Instantiate queue for popup messages
         canSemaphore = xSemaphoreCreateMutex();
     }
@@ -158,15 +155,8 @@ class CanDisplayPopupHandler2 : public ICanDisplayPopupHandler
         canDisplayPopupStartTime = millis();
 
         popupVisible = true;
-        uint8_t messageSentCount = 0;
-
-        while (messageSentCount < CAN_POPUP_MESSAGE_SEND_COUNT) {
-            displayMessageSender->ShowPopup(category, messageType, kmToDisplay,
-                doorStatus1, doorStatus2);
-            messageSentCount++;
-
-            vTaskDelay(5 / portTICK_PERIOD_MS);
-        }
+        displayMessageSender.ShowPopup(category, messageType, kmToDisplay,
+            doorStatus1, doorStatus2);
 
     }
 
@@ -175,12 +165,7 @@ class CanDisplayPopupHandler2 : public ICanDisplayPopupHandler
     }
 
     void HideCanPopupMessage(uint8_t messageType, uint8_t doorStatus, int counter) {
-        uint8_t messageSentCount = 0;
-        while (messageSentCount < CAN_POPUP_MESSAGE_SEND_COUNT) {
-            displayMessageSender->HidePopup(messageType);
-            messageSentCount++;
-            vTaskDelay(5 / portTICK_PERIOD_MS);
-        }
+        displayMessageSender.HidePopup(messageType);
         lastPopupMessage.DisplayTimeInMilliSeconds = 0;
         popupVisible = false;
         previousCanPopupTime = millis();
@@ -208,6 +193,10 @@ class CanDisplayPopupHandler2 : public ICanDisplayPopupHandler
         ignition = ign;
     }
 
+    CanFrameSequence* GetFrameSequence() {
+        return &popupSequence;
+    }
+
     bool GetIgnition() {
         return ignition;
     }
@@ -245,7 +234,9 @@ class CanDisplayPopupHandler2 : public ICanDisplayPopupHandler
 private:
 
     AbstractCanMessageSender* canMessageSender;
-    CanDisplayPacketSender* displayMessageSender;
+    CanFrameSequence popupSequence;
+    CanFrameSequenceWriter popupSequenceWriter;
+    CanDisplayPacketSender displayMessageSender;
     //ByteAcceptanceHandler* byteAcceptanceHandler;
 
     bool riskOfIceShown = false;
@@ -269,7 +260,10 @@ class CanDisplayPopupHandler2 : public ICanDisplayPopupHandler
     SemaphoreHandle_t canSemaphore;
     const int CAN_POPUP_MESSAGE_TIME = 4000;
 
-    const uint8_t CAN_POPUP_MESSAGE_SEND_COUNT = 2;
+    // static as the frame sequence members declared above are constructed from them
+    const static uint8_t CAN_POPUP_MESSAGE_SEND_COUNT = 2;
+    const static uint8_t CAN_POPUP_MESSAGE_SEND_INTERVAL = 5;
+    const static uint8_t CAN_POPUP_SEQUENCE_LENGTH = 4;
     const int chillTime = 10;//time to wait between display popups with the same ID (it's annoying when the same popups display a long time)
 
     void PushPopupMsg(CanDisplayPopupItem* item, SemaphoreHandle_t sem,
@@ -7,17 +7,27 @@
 #include "../AbstractCanMessageSender.h"
 #include "../Structs/CanDisplayStructs.h"
 #include "../../Helpers/CanDisplayPopupItem.h"
+#include "../../Helpers/PopupRateLimiter.h"
+#include "../../Helpers/VanCanDisplayPopupMap.h"
 #include "ICanDisplayPopupHandler.h"
 
 class CanDisplayPopupHandler3 : public ICanDisplayPopupHandler
 {
     const uint8_t  CAN_POPUP_MESSAGE_SEND_COUNT = 2;
+    const uint8_t  CAN_POPUP_MESSAGE_SEND_INTERVAL = 5;
+    const uint8_t  CAN_POPUP_SEQUENCE_LENGTH = 4;
     const uint16_t CAN_POPUP_INTERVAL = 400;
     const uint16_t CAN_POPUP_MESSAGE_MAX_DISPLAY_TIME = 6000;
     const uint16_t MESSAGE_CHILLTIME = 24000;
+    // a slot for every popup type which can be queued, so a chill time is never cut short: the types the VAN popups are
+    // mapped to (including 0 for the unmapped ones) and the risk of ice popup raised by the ignition task
+    const static uint8_t CHILLTIME_POPUP_COUNT = CountDistinctLookupValues(VAN_TO_CAN_POPUP_MESSAGE_ENTRIES) + 1;
+    static_assert(ContainsLookupValue(VAN_TO_CAN_POPUP_MESSAGE_ENTRIES, 0), "the unmapped VAN popups have no slot for their chill time");
 
     AbstractCanMessageSender *canMessageSender;
-    CanDisplayPacketSender *displayMessageSender;
+    CanFrameSequence popupSequence;
+    CanFrameSequenceWriter popupSequenceWriter;
+    CanDisplayPacketSender displayMessageSender;
 
     bool riskOfIceShown = false;
     bool seatbeltWarningShown = false;
@@ -27,7 +37,7 @@ class CanDisplayPopupHandler3 : public ICanDisplayPopupHandler
     unsigned long previousRunTime = millis();
     unsigned long popupAddedToShow = millis();
 
-    unsigned long popupMessageTime[256] = { 0 };
+    PopupRateLimiter<CHILLTIME_POPUP_COUNT> popupRateLimiter;
 
     CanDisplayPopupItem currentPopupMessage;
     CanDisplayPopupItem currentDoorMessage;
@@ -35,10 +45,13 @@ class CanDisplayPopupHandler3 : public ICanDisplayPopupHandler
     bool isNonDoorMessageVisible = false;
 
     public:
-    CanDisplayPopupHandler3(AbstractCanMessageSender * object)
+    CanDisplayPopupHandler3(AbstractCanMessageSender * object) :
+        popupSequence(object, CAN_POPUP_SEQUENCE_LENGTH),
+        popupSequenceWriter(&popupSequence, CAN_POPUP_MESSAGE_SEND_COUNT, CAN_POPUP_MESSAGE_SEND_INTERVAL),
+        displayMessageSender(&popupSequenceWriter),
+        popupRateLimiter(MESSAGE_CHILLTIME)
     {
         canMessageSender = object;
-        displayMessageSender = new CanDisplayPacketSender(canMessageSender);
         currentPopupMessage.MessageType = CAN_POPUP_MSG_NONE;
         currentPopupMessage.Category = CAN_POPUP_MSG_SHOW_CATEGORY3;
         currentDoorMessage.DoorStatus1 = 0x00;
@@ -58,11 +71,7 @@ class CanDisplayPopupHandler3 : public ICanDisplayPopupHandler
 
         if (!isIncomingDoorMessage)
         {
-            if (currentTime - popupMessageTime[incomingMessageType] > MESSAGE_CHILLTIME)
-            {
-                popupMessageTime[incomingMessageType] = currentTime;
-            }
-            else
+            if (!popupRateLimiter.TryShow(incomingMessageType, currentTime))
             {
                 return;
             }
@@ -156,13 +165,7 @@ class CanDisplayPopupHandler3 : public ICanDisplayPopupHandler
     }
 
     void ShowPopupMessage(CanDisplayPopupItem message) {
-        uint8_t messageSentCount = 0;
-        while (messageSentCount < CAN_POPUP_MESSAGE_SEND_COUNT)
-        {
-            displayMessageSender->ShowPopup(message.Category, message.MessageType, message.KmToDisplay, message.DoorStatus1, message.DoorStatus2);
-            messageSentCount++;
-            vTaskDelay(5 / portTICK_PERIOD_MS);
-        }
+        displayMessageSender.ShowPopup(message.Category, message.MessageType, message.KmToDisplay, message.DoorStatus1, message.DoorStatus2);
 
         if (message.MessageType == CAN_POPUP_MSG_DOORS_BOOT_BONNET_REAR_SCREEN_AND_FUEL_TANK_OPEN)
         {
@@ -191,14 +194,7 @@ class CanDisplayPopupHandler3 : public ICanDisplayPopupHandler
     {
         if (isPopupVisible)
         {
-            uint8_t messageSentCount = 0;
-
-            while (messageSentCount < CAN_POPUP_MESSAGE_SEND_COUNT)
-            {
-                displayMessageSender->HidePopup(currentPopupMessage.MessageType);
-                messageSentCount++;
-                vTaskDelay(5 / portTICK_PERIOD_MS);
-            }
+            displayMessageSender.HidePopup(currentPopupMessage.MessageType);
             isPopupVisible = false;
             isNonDoorMessageVisible = false;
             isDoorMessageVisible = false;
@@ -222,10 +218,7 @@ class CanDisplayPopupHandler3 : public ICanDisplayPopupHandler
         currentPopupMessage.Category = CAN_POPUP_MSG_SHOW_CATEGORY3;
         currentDoorMessage.DoorStatus1 = 0x00;
 
-        for (size_t i = 0; i < 256; i++)
-        {
-            popupMessageTime[i] = 0;
-        }
+        popupRateLimiter.Reset();
     }
 
     void ResetSeatBeltWarning()
@@ -248,6 +241,11 @@ class CanDisplayPopupHandler3 : public ICanDisplayPopupHandler
         isIgnitionOn = isOn;
     }
 
+    CanFrameSequence* GetFrameSequence()
+    {
+        return &popupSequence;
+    }
+
     bool DoorMessageCanBeDisplayed()
     {
         return
@@ -6,34 +6,94 @@
 
 #include "../AbstractCanMessageSender.h"
 
+/*
+    A periodic CAN message (heartbeat). The heartbeats are sent by the CanHeartbeatScheduler at their deadlines, from the task
+    which feeds the handler with SetData() and Process().
+    If a minimum interval is given, the message is also sent from Process() as soon as the handler reports a change with
+    SetDataChanged(), but not more often than every minimumInterval milliseconds.
+*/
 class CanMessageHandlerBase
 {
-    unsigned long previousTime = 0;
+    unsigned long previousSendTime = 0;
+    unsigned long lastProcessTime = 0;
+    bool isProcessed = false;
+    bool dataChanged = false;
+
+    uint32_t sentCount = 0;
 
     virtual void InternalProcess() = 0;
 
+    void Send(unsigned long currentTime)
+    {
+        previousSendTime = currentTime;
+        _currentTime = currentTime;
+        dataChanged = false;
+        sentCount++;
+
+        InternalProcess();
+    }
+
     protected:
+    uint16_t canId;
     uint16_t processInterval = 40;
+    // 0 disables sending on change
+    uint16_t minimumInterval = 0;
     unsigned long _currentTime = 0;
 
     AbstractCanMessageSender *canMessageSender;
-    CanMessageHandlerBase(AbstractCanMessageSender * object, uint16_t interval)
+    CanMessageHandlerBase(AbstractCanMessageSender * object, uint16_t id, uint16_t interval, uint16_t minInterval = 0)
     {
+        canId = id;
         processInterval = interval;
+        minimumInterval = minInterval;
         canMessageSender = object;
     }
 
+    /* Called from SetData() when a value sent in the message is different from the previous one */
+    void SetDataChanged()
+    {
+        dataChanged = true;
+    }
+
     public:
+    /* Called by the task feeding the handler after SetData(), the heartbeats are only sent while this is called */
     void Process(unsigned long currentTime)
     {
-        if (currentTime - previousTime > processInterval)
-        {
-            previousTime = currentTime;
-            _currentTime = currentTime;
+        lastProcessTime = currentTime;
+        isProcessed = true;
 
-            InternalProcess();
+        if (dataChanged && minimumInterval > 0 && currentTime - previousSendTime >= minimumInterval)
+        {
+            Send(currentTime);
         }
     }
+
+    /* Called by the CanHeartbeatScheduler at the deadline, from the same task as Process() */
+    void SendHeartbeat(unsigned long currentTime)
+    {
+        Send(currentTime);
+    }
+
+    /* True if Process() was called in the last timeout milliseconds */
+    bool IsProcessed(unsigned long currentTime, uint16_t timeout)
+    {
+        return isProcessed && currentTime - lastProcessTime <= timeout;
+    }
+
+    uint16_t GetCanId()
+    {
+        return canId;
+    }
+
+    uint16_t GetProcessInterval()
+    {
+        return processInterval;
+    }
+
+    uint32_t GetSentCount()
+    {
+        return sentCount;
+    }
 };
 
 #endif
@@ -14,17 +14,16 @@ class CanNaviPositionHandler : public CanMessageHandlerBase
     uint16_t _leftWheel = 0;
     uint16_t _rightWheel = 0;
 
-    CanNaviPositionPacketSender* packetSender;
+    CanNaviPositionPacketSender packetSender;
 
     void InternalProcess() override
     {
-        packetSender->Send(_rightWheel, _leftWheel);
+        packetSender.Send(_rightWheel, _leftWheel);
     }
 
     public:
-    CanNaviPositionHandler(AbstractCanMessageSender * object) : CanMessageHandlerBase(object, CAN_SPEED_RPM_INTERVAL)
+    CanNaviPositionHandler(AbstractCanMessageSender * object) : CanMessageHandlerBase(object, CAN_ID_NAVI_POS, CAN_SPEED_RPM_INTERVAL), packetSender(object)
     {
-        packetSender = new CanNaviPositionPacketSender(object);
     }
 
     void SetData(uint16_t rightWheel, uint16_t leftWheel)
@@ -22,7 +22,7 @@ class CanParkingAidHandler : public CanMessageHandlerBase
     uint8_t _interiorRearLeft = 0;
     uint8_t _interiorRearRight = 0;
 
-    CanParkingAidPacketSender* packetSender;
+    CanParkingAidPacketSender packetSender;
 
     uint8_t GetBarCountFromDistance(uint8_t distanceData, bool isCorner)
     {
@@ -71,14 +71,13 @@ class CanParkingAidHandler : public CanMessageHandlerBase
                 rear = intRearRight;
             }
 
-            packetSender->Send(rearLeft, rear, rearRight, 0, 0, 0, ENABLE_PARKING_AID_SOUND_FROM_SPEAKER);
+            packetSender.Send(rearLeft, rear, rearRight, 0, 0, 0, ENABLE_PARKING_AID_SOUND_FROM_SPEAKER);
         }
     }
 
     public:
-    CanParkingAidHandler(AbstractCanMessageSender * object) : CanMessageHandlerBase(object, CAN_PARKING_AID_INTERVAL)
+    CanParkingAidHandler(AbstractCanMessageSender * object) : CanMessageHandlerBase(object, CAN_ID_PARKING_AID, CAN_PARKING_AID_INTERVAL), packetSender(object)
     {
-        packetSender = new CanParkingAidPacketSender(object);
     }
 
     void SetData(uint8_t isActive, uint8_t isTrailerPresent, uint8_t exteriorRearLeft, uint8_t exteriorRearRight, uint8_t interiorRearLeft, uint8_t interiorRearRight, unsigned long currentTime)
@@ -41,21 +41,18 @@ class CanPinConfigHandler : public AbstractCanMessageHandler
 
         if (canId == CAN_ID_RADIO_TUNER)
         {
-            const CanRadioTunerPacket packet = DeSerialize<CanRadioTunerPacket>(canMsg);
-            band = packet.data.Band.band;
-            freq1 = packet.data.Frequency1;
-            freq2 = packet.data.Frequency2;
+            band = CanRadioTunerBandField::Get(canMsg);
+            freq1 = CanRadioTunerFrequency1Field::Get(canMsg);
+            freq2 = CanRadioTunerFrequency2Field::Get(canMsg);
         }
         if (canId == CAN_ID_DISPLAY_MENU)
         {
-            const CanDisplayMenuPacket packet = DeSerialize<CanDisplayMenuPacket>(canMsg);
-            menu = packet.data.Byte1.menu_open;
+            menu = CanDisplayMenuOpenField::Get(canMsg);
         }
         if (canId == CAN_ID_RADIO)
         {
-            const CanRadioPacket packet = DeSerialize<CanRadioPacket>(canMsg);
-            radioEnabled = packet.data.Field1.radio_enabled == 1;
-            source = packet.data.Source.source;
+            radioEnabled = CanRadioEnabledField::Get(canMsg) == 1;
+            source = CanRadioSourceField::Get(canMsg);
         }
 
         readKeyCombo = radioEnabled && source == CAN_RADIO_SOURCE_TUNER &&
@@ -13,26 +13,25 @@
 
 class CanRadioRd4DiagHandler : public AbstractCanMessageHandler
 {
-    CanRadioRd4DiagPacketSender* _packetSender;
+    CanRadioRd4DiagPacketSender _packetSender;
     AbsSer* _serialPort;
     IVinFlashStorage* _vinFlashStorage;
 
     public:
-    CanRadioRd4DiagHandler(AbstractCanMessageSender* object, AbsSer* serialPort, IVinFlashStorage* vinFlashStorage)
+    CanRadioRd4DiagHandler(AbstractCanMessageSender* object, AbsSer* serialPort, IVinFlashStorage* vinFlashStorage) : _packetSender(object)
     {
-        _packetSender = new CanRadioRd4DiagPacketSender(object);
         _serialPort = serialPort;
         _vinFlashStorage = vinFlashStorage;
     }
 
     void SetRadioType(uint8_t radioType)
     {
-        _packetSender->SetRadioType(radioType);
+        _packetSender.SetRadioType(radioType);
     }
 
     void GetVin()
     {
-        _packetSender->EnterDiagMode();
+        _packetSender.EnterDiagMode();
     }
 
     bool ProcessMessage(const uint16_t canId, const uint8_t length, const uint8_t canMsg[]) override
@@ -41,13 +40,13 @@ class CanRadioRd4DiagHandler : public AbstractCanMessageHandler
         {
             return false;
         }
-        _packetSender->ProcessReceivedCanMessage(canId, length, canMsg);
+        _packetSender.ProcessReceivedCanMessage(canId, length, canMsg);
         //delayMicroseconds(40);
-        if (_packetSender->IsVinRead)
+        if (_packetSender.IsVinRead)
         {
             for (int i = 0; i < 17; ++i)
             {
-                Vin[i] = _packetSender->Vin[i];
+                Vin[i] = _packetSender.Vin[i];
             }
 
             const bool success = _vinFlashStorage->Save();
@@ -61,7 +60,7 @@ class CanRadioRd4DiagHandler : public AbstractCanMessageHandler
                 _serialPort->println("VIN save failed");
             }
 
-            _packetSender->IsVinRead = false;
+            _packetSender.IsVinRead = false;
         }
 
         return false;
@@ -12,7 +12,7 @@ class CanRadioRemoteMessageHandler : public CanMessageHandlerBase
 {
     static const uint16_t CAN_RADIO_REMOTE_MESSAGE_INTERVAL = 500;
 
-    CanRadioRemoteButtonPacketSender* RadioRemoteSender;
+    CanRadioRemoteButtonPacketSender RadioRemoteSender;
 
     uint8_t ButtonByte;
     uint8_t ScrollByte;
@@ -33,20 +33,19 @@ class CanRadioRemoteMessageHandler : public CanMessageHandlerBase
         {
             if (SendEmpty)
             {
-                RadioRemoteSender->SendAsByte(0x00, 0x00);
+                RadioRemoteSender.SendAsByte(0x00, 0x00);
                 SendEmpty = false;
             }
         }
         else
         {
-            RadioRemoteSender->SendAsByte(ButtonByte, ScrollByte);
+            RadioRemoteSender.SendAsByte(ButtonByte, ScrollByte);
         }
     }
 
     public:
-    CanRadioRemoteMessageHandler(AbstractCanMessageSender* object) : CanMessageHandlerBase(object, CAN_RADIO_REMOTE_MESSAGE_INTERVAL)
+    CanRadioRemoteMessageHandler(AbstractCanMessageSender* object) : CanMessageHandlerBase(object, CAN_ID_RADIO_REMOTE, CAN_RADIO_REMOTE_MESSAGE_INTERVAL), RadioRemoteSender(object)
     {
-        RadioRemoteSender = new CanRadioRemoteButtonPacketSender(object);
     }
 
     void SetData(
@@ -69,7 +68,7 @@ class CanRadioRemoteMessageHandler : public CanMessageHandlerBase
 
             if (sendData)
             {
-                RadioRemoteSender->SendAsByte(buttonByte, scrollByte);
+                RadioRemoteSender.SendAsByte(buttonByte, scrollByte);
                 SendEmpty = true;
             }
         }
@@ -78,7 +77,7 @@ class CanRadioRemoteMessageHandler : public CanMessageHandlerBase
             ButtonByte = buttonByte;
             ScrollByte = scrollByte;
 
-            RadioRemoteSender->SendAsByte(ButtonByte, ScrollByte);
+            RadioRemoteSender.SendAsByte(ButtonByte, ScrollByte);
         }
     }
 
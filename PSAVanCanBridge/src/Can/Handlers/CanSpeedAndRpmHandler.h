@@ -15,17 +15,16 @@ class CanSpeedAndRpmHandler : public CanMessageHandlerBase
     uint16_t _rpm = 0;
     uint16_t _distance;
 
-    CanSpeedAndRpmPacketSender* speedAndRpmSender;
+    CanSpeedAndRpmPacketSender speedAndRpmSender;
 
     void InternalProcess() override
     {
-        speedAndRpmSender->Send(_speed, _rpm, _distance);
+        speedAndRpmSender.Send(_speed, _rpm, _distance);
     }
 
     public:
-    CanSpeedAndRpmHandler(AbstractCanMessageSender * object) : CanMessageHandlerBase(object, CAN_SPEED_RPM_INTERVAL)
+    CanSpeedAndRpmHandler(AbstractCanMessageSender * object) : CanMessageHandlerBase(object, CAN_ID_SPEED_AND_RPM, CAN_SPEED_RPM_INTERVAL), speedAndRpmSender(object)
     {
-        speedAndRpmSender = new CanSpeedAndRpmPacketSender(object);
     }
 
     void SetData(uint8_t speed, uint16_t rpm, uint16_t distance)
@@ -7,13 +7,18 @@
 #include "../Structs/CanTrip1Structs.h"
 #include "../Structs/CanTrip2Structs.h"
 #include "../AbstractCanMessageSender.h"
+#include "../CanFrameSequence.h"
 
 class CanTripInfoHandler
 {
     const int CAN_TRIP_INTERVAL = 333;
     const int CAN_TRIP_SEND_COUNT = 10;
+    const uint8_t CAN_TRIP_SEND_INTERVAL = 5;
+    const uint8_t CAN_TRIP_SEQUENCE_LENGTH = 2;
 
     AbstractCanMessageSender *canMessageSender;
+    CanFrameSequence tripButtonSequence;
+    CanFrameSequenceWriter tripButtonSequenceWriter;
 
     unsigned long previousTrip0Time = millis();
 
@@ -27,9 +32,7 @@ class CanTripInfoHandler
     int Trip2Consumption = 0;
     int FuelConsumption = 0;
     int FuelLeftToPump = 0;
-    uint8_t TripButtonPressed = 0;
 
-    int IsSendingEnabled = 1;
     uint8_t ValueToUpdate = 1;
     bool PreventTripChange = false;
 
@@ -52,10 +55,16 @@ class CanTripInfoHandler
     }
 
     public:
-    CanTripInfoHandler(AbstractCanMessageSender * object)
+    CanTripInfoHandler(AbstractCanMessageSender * object) :
+        tripButtonSequence(object, CAN_TRIP_SEQUENCE_LENGTH),
+        tripButtonSequenceWriter(&tripButtonSequence, CAN_TRIP_SEND_COUNT, CAN_TRIP_SEND_INTERVAL)
     {
         canMessageSender = object;
-        IsSendingEnabled = 1;
+    }
+
+    CanFrameSequence* GetFrameSequence()
+    {
+        return &tripButtonSequence;
     }
 
     void TripResetHappened()
@@ -72,31 +81,14 @@ class CanTripInfoHandler
             PreventTripChange = false;
             return;
         }
-        if (TripButtonPressed == 0 && IsSendingEnabled == 1)
+        if (tripButtonSequence.IsIdle())
         {
-            IsSendingEnabled = 0;
-            TripButtonPressed = 1;
-            uint8_t messageSentCount = 0;
-
             // we have to send the "trip button pressed" state several times to change the trip computer on the display
             // the display changes the trip computer after we don't send the "trip button pressed" state any more
-            while (messageSentCount < CAN_TRIP_SEND_COUNT)
-            {
-                SendCanTripInfo0(FuelLeftToPump, FuelConsumption, Speed, TripButtonPressed);
-
-                messageSentCount++;
-                vTaskDelay(5 / portTICK_PERIOD_MS);
-            }
-            messageSentCount = 0;
-            while (messageSentCount < CAN_TRIP_SEND_COUNT)
-            {
-                SendCanTripInfo0(FuelLeftToPump, FuelConsumption, Speed, 0);
-
-                messageSentCount++;
-                vTaskDelay(5 / portTICK_PERIOD_MS);
-            }
-            TripButtonPressed = 0;
-            IsSendingEnabled = 1;
+            // the periodic trip messages are paused until the sequence is sent
+            CanTrip0PacketSender tripButtonSender(&tripButtonSequenceWriter);
+            tripButtonSender.SendTripInfo(FuelLeftToPump, FuelConsumption, Speed, 1);
+            tripButtonSender.SendTripInfo(FuelLeftToPump, FuelConsumption, Speed, 0);
         }
     }
 
@@ -121,7 +113,7 @@ class CanTripInfoHandler
 
     void Process(unsigned long currentTime)
     {
-        if (IsSendingEnabled == 1 && currentTime - previousTrip0Time > CAN_TRIP_INTERVAL)
+        if (tripButtonSequence.IsIdle() && currentTime - previousTrip0Time > CAN_TRIP_INTERVAL)
         {
             previousTrip0Time = currentTime;
 
@@ -138,7 +130,7 @@ class CanTripInfoHandler
             {
                 case 1:
                 {
-                    SendCanTripInfo0(FuelLeftToPump, FuelConsumption, Speed, TripButtonPressed);
+                    SendCanTripInfo0(FuelLeftToPump, FuelConsumption, Speed, 0);
                     break;
                 }
                 case 2:
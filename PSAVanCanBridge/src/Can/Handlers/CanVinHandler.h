@@ -5,27 +5,26 @@
 
 #include "../Structs/CanVinStructs.h"
 #include "../AbstractCanMessageSender.h"
-#include "../../../config.h"
+#include "../../../Config.h"
 
 class CanVinHandler
 {
     const uint16_t CAN_VIN_INTERVAL = 200;
 
     AbstractCanMessageSender *canMessageSender;
-    CanVinPacketSender *canVinSender;
+    CanVinPacketSender canVinSender;
 
     unsigned long prevVinTime= 0;
 
     uint8_t vinPartToSend = 1;
 
     public:
-    CanVinHandler(AbstractCanMessageSender * object)
+    CanVinHandler(AbstractCanMessageSender * object) : canVinSender(object)
     {
         canMessageSender = object;
-        canVinSender = new CanVinPacketSender(canMessageSender);
     }
 
-    void SetVin(uint8_t vinBytes[17])
+    void SetVin(const uint8_t vinBytes[17])
     {
         if (!IsVinSet())
         {
@@ -45,18 +44,18 @@ class CanVinHandler
                 {
                     case 1:
                     {
-                        canVinSender->SendVinPart1(Vin);
+                        canVinSender.SendVinPart1(Vin);
                         break;
                     }
                     case 2:
                     {
-                        canVinSender->SendVinPart2(Vin);
+                        canVinSender.SendVinPart2(Vin);
                         break;
                     }
                     case 3:
                     {
                         //for the radio to stop beeping it is enough to send the last part of the VIN
-                        canVinSender->SendVinPart3(Vin);
+                        canVinSender.SendVinPart3(Vin);
                         break;
                     }
                     default:
@@ -5,6 +5,7 @@
     #define _ICanDisplayPopupHandler_h
 
 #include "../../Helpers/CanDisplayPopupItem.h"
+#include "../CanFrameSequence.h"
 
 class ICanDisplayPopupHandler
 {
@@ -25,6 +26,9 @@ class ICanDisplayPopupHandler
         virtual void SetEngineRunning(bool isRunning) = 0;
 
         virtual void SetIgnition(bool isOn) = 0;
+
+        // the repeated popup frames are sent through this sequence
+        virtual CanFrameSequence* GetFrameSequence() = 0;
 };
 
 #endif
@@ -5,7 +5,7 @@
     #define _CanAirConOnDisplayStructs_h
 
 #include "../AbstractCanMessageSender.h"
-#include "../../Helpers/PacketGenerator.h"
+#include "../Generated/CanSignals.h"
 
 // CANID: 1E3
 const uint16_t CAN_ID_AIRCON_ON_DIPSLAY = 0x1E3;
@@ -147,33 +147,26 @@ class CanAirConditionOnDisplayPacketSender
 
     void SendACDataToDisplay(float temperatureLeft, float temperatureRight , uint8_t direction, uint8_t autoMode, uint8_t acOff, uint8_t off, uint8_t windshield, uint8_t fanSpeed, uint8_t recyclingOn)
     {
-        PacketGenerator<CanAirConOnDisplayPacket> generator;
-        generator.packet.data.Modes.auto_mode = autoMode;
-        generator.packet.data.Modes.ac_off = acOff;
-        generator.packet.data.Modes.off = off;
+        uint8_t data[CanAirConOnDisplaySignals::LENGTH] = { 0 };
 
-        generator.packet.data.WindShieldIf0x80.windshield = windshield;
+        CanAirConOnDisplaySignals::SetAutoMode(data, autoMode);
+        CanAirConOnDisplaySignals::SetAirConOff(data, acOff);
+        CanAirConOnDisplaySignals::SetOff(data, off);
 
-        generator.packet.data.Modes.separate_sides = 0;
-        generator.packet.data.TemperatureLeft = CanAirConToDisplayGetTemperature(temperatureLeft);
-        generator.packet.data.TemperatureRight = CanAirConToDisplayGetTemperature(temperatureRight);
-        generator.packet.data.AirDirectionLeft = direction;
-        generator.packet.data.AirDirectionRight = direction;
-        generator.packet.data.Speed = CanAirConToDisplayGetFanSpeed(fanSpeed);
+        CanAirConOnDisplaySignals::SetWindshield(data, windshield);
 
-        if (recyclingOn == 1)
-        {
-            generator.packet.data.Modes.unknown2 = 1;
-            generator.packet.data.Modes.outside_air = 1;
-        }
-        else
-        {
-            generator.packet.data.Modes.unknown2 = 0;
-            generator.packet.data.Modes.outside_air = 0;
-        }
+        CanAirConOnDisplaySignals::SetSeparateSides(data, 0);
+        CanAirConOnDisplaySignals::SetTemperatureLeft(data, CanAirConToDisplayGetTemperature(temperatureLeft));
+        CanAirConOnDisplaySignals::SetTemperatureRight(data, CanAirConToDisplayGetTemperature(temperatureRight));
+        CanAirConOnDisplaySignals::SetAirDirectionLeft(data, direction);
+        CanAirConOnDisplaySignals::SetAirDirectionRight(data, direction);
+        CanAirConOnDisplaySignals::SetFanSpeed(data, CanAirConToDisplayGetFanSpeed(fanSpeed));
+
+        // the display shows the recycling message only if the outside air bit is also set
+        CanAirConOnDisplaySignals::SetCabinAirRecycling(data, recyclingOn == 1);
+        CanAirConOnDisplaySignals::SetOutsideAir(data, recyclingOn == 1);
 
-        unsigned char *serializedPacket = generator.GetSerializedPacket();
-        canMessageSender->SendMessage(CAN_ID_AIRCON_ON_DIPSLAY, 0, sizeof(CanAirConOnDisplayPacket), serializedPacket);
+        canMessageSender->SendMessage(CAN_ID_AIRCON_ON_DIPSLAY, 0, sizeof(data), data);
     }
 
 };
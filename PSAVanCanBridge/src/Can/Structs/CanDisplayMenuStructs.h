@@ -4,6 +4,7 @@
 #ifndef _CanDisplayMenuStructs_h
     #define _CanDisplayMenuStructs_h
 
+#include "../../Helpers/BitField.h"
 
 // CANID: 0DF
 const uint16_t CAN_ID_DISPLAY_MENU = 0x0DF;
@@ -43,4 +44,7 @@ union CanDisplayMenuPacket {
     uint8_t CanDisplayMenuPacket[sizeof(CanDisplayMenuStruct)];
 };
 
+// fields read straight from a received message
+typedef BitField<0, 7, 1> CanDisplayMenuOpenField;
+
 #endif
@@ -5,7 +5,7 @@
     #define _CanDisplayStructs_h
 
 #include "../AbstractCanMessageSender.h"
-#include "../../Helpers/PacketGenerator.h"
+#include "../Generated/CanSignals.h"
 
 #pragma region Popup message consts
 //0x80
@@ -219,14 +219,6 @@ union CanDisplayPacket {
     uint8_t CanDisplayPacket[sizeof(CanDisplayStruct)];
 };
 
-int static CanGetHighKmToDisplay(int kmToDisplay) {
-    return kmToDisplay / 256;
-}
-
-int static CanGetLowKmToDisplay(int kmToDisplay){
-    return kmToDisplay - (CanGetHighKmToDisplay(kmToDisplay) * 256);
-}
-
 #pragma region Sender class
 class CanDisplayPacketSender
 {
@@ -240,43 +232,34 @@ class CanDisplayPacketSender
 
     void ShowPopup(uint8_t category, uint8_t messageType, int kmToDisplay, uint8_t doorStatus1, uint8_t doorStatus2)
     {
-        int bytes7 = CanGetHighKmToDisplay(kmToDisplay);
-        int bytes8 = CanGetLowKmToDisplay(kmToDisplay);
+        uint8_t data[CanDisplayPopupSignals::LENGTH] = { 0 };
 
-        PacketGenerator<CanDisplayPacket> generator;
-        generator.packet.data.ShowPopup = category;
-        generator.packet.data.PopupMessageType = messageType;
-        generator.packet.data.Field2.show_popup = 1;
+        CanDisplayPopupSignals::SetCategory(data, category);
+        CanDisplayPopupSignals::SetMessageType(data, messageType);
+        CanDisplayPopupSignals::SetShowPopup(data, 1);
 
-        generator.packet.data.DoorStatus1.asByte = doorStatus1;
-        generator.packet.data.DoorStatus2.asByte = doorStatus2;
+        CanDisplayPopupSignals::SetDoorStatus1(data, doorStatus1);
+        CanDisplayPopupSignals::SetDoorStatus2(data, doorStatus2);
 
-        generator.packet.data.KmDividedBy256 = bytes7;
-        generator.packet.data.KmRemainderUpTo255 = bytes8;
-        unsigned char *serializedPacket = generator.GetSerializedPacket();
+        CanDisplayPopupSignals::SetKm(data, kmToDisplay);
         if (messageType == CAN_POPUP_MSG_AIRBAGS_OR_PRETENSIONER_SEAT_BELTS_FAULTY)
         {
-            serializedPacket[3] = 0x80;
+            CanDisplayPopupSignals::SetDoorStatus1(data, 0x80);
         }
 
-        canMessageSender->SendMessage(CAN_ID_DISPLAY_POPUP, 0, sizeof(CanDisplayPacket), serializedPacket);
+        canMessageSender->SendMessage(CAN_ID_DISPLAY_POPUP, 0, sizeof(data), data);
     }
 
     void HidePopup(uint8_t messageType)
     {
-        PacketGenerator<CanDisplayPacket> generator;
-        generator.packet.data.ShowPopup = CAN_POPUP_MSG_HIDE;
-        generator.packet.data.PopupMessageType = messageType;
-        generator.packet.data.Field2.show_popup = 0;
-        generator.packet.data.KmDividedBy256 = 0;
-        generator.packet.data.KmRemainderUpTo255 = 0;
-        unsigned char *serializedPacket = generator.GetSerializedPacket();
-        serializedPacket[3] = 0xff;
-        serializedPacket[4] = 0xff;
-        serializedPacket[5] = 0xff;
-        serializedPacket[6] = 0xff;
-        serializedPacket[7] = 0xff;
-        canMessageSender->SendMessage(CAN_ID_DISPLAY_POPUP, 0, sizeof(CanDisplayPacket), serializedPacket);
+        // everything after the show bit is all ones
+        uint8_t data[CanDisplayPopupSignals::LENGTH] = { 0, 0, 0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+
+        CanDisplayPopupSignals::SetCategory(data, CAN_POPUP_MSG_HIDE);
+        CanDisplayPopupSignals::SetMessageType(data, messageType);
+        CanDisplayPopupSignals::SetShowPopup(data, 0);
+
+        canMessageSender->SendMessage(CAN_ID_DISPLAY_POPUP, 0, sizeof(data), data);
     }
 
 };
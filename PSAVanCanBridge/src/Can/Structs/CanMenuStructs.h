@@ -6,6 +6,7 @@
 
 #include "../AbstractCanMessageSender.h"
 #include "../../Helpers/PacketGenerator.h"
+#include "../../Helpers/BitField.h"
 
 // CANID: 3E5
 const uint16_t CAN_ID_MENU_BUTTONS = 0x3E5;
@@ -92,6 +93,9 @@ union CanMenuPacket {
     uint8_t CanMenuPacket[sizeof(CanMenuStruct)];
 };
 
+// fields read straight from a received message
+typedef BitField<2, 4, 1> CanMenuEscButtonField;
+
 //https://stackoverflow.com/a/9196883/5453350
 static int CONST_CAN_RADIO_MENUBUTTONS[] = { CONST_UP_ARROW, CONST_DOWN_ARROW, CONST_LEFT_ARROW, CONST_RIGHT_ARROW, CONST_ESC_BUTTON, CONST_OK_BUTTON, CONST_MENU_BUTTON, CONST_MODE_BUTTON, CONST_TRIP_BUTTON };
 
@@ -5,7 +5,7 @@
     #define _CanParkingAidStructs_h
 
 #include "../AbstractCanMessageSender.h"
-#include "../../Helpers/PacketGenerator.h"
+#include "../Generated/CanSignals.h"
 
 // CANID: 0E1
 const uint16_t CAN_ID_PARKING_AID = 0x0E1;
@@ -321,30 +321,29 @@ class CanParkingAidPacketSender
     //on the corners maxumum 3 bars
     void Send(uint8_t rearLeft, uint8_t rear, uint8_t rearRight, uint8_t frontLeft, uint8_t front, uint8_t frontRight, uint8_t soundEnabled)
     {
-        PacketGenerator<CanParkingAidPacket> generator;
+        uint8_t data[CanParkingAidSignals::LENGTH] = { 0 };
 
-        generator.packet.data.SoundOptions.sound_enabled = soundEnabled;
-        generator.packet.data.SoundOptions.channel = 1;
-        generator.packet.data.SoundOptions.left_channel_sound = 1;
-        generator.packet.data.SoundOptions.right_channel_sound = 1;
+        CanParkingAidSignals::SetSoundEnabled(data, soundEnabled);
+        CanParkingAidSignals::SetFrontChannel(data, 1);
+        CanParkingAidSignals::SetLeftChannelSound(data, 1);
+        CanParkingAidSignals::SetRightChannelSound(data, 1);
 
-        generator.packet.data.BeepPeriod.beep_period = GetBeepPeriod(rearLeft, rear, rearRight, frontLeft, front, frontRight);
+        CanParkingAidSignals::SetBeepPeriod(data, GetBeepPeriod(rearLeft, rear, rearRight, frontLeft, front, frontRight));
 
-        generator.packet.data.RearAndRearLeft.rear = GetByteFromBarCount(rear, PP_REAR);
-        generator.packet.data.RearAndRearLeft.rear_left = GetByteFromBarCount(rearLeft, PP_REAR_LEFT);
+        CanParkingAidSignals::SetRear(data, GetByteFromBarCount(rear, PP_REAR));
+        CanParkingAidSignals::SetRearLeft(data, GetByteFromBarCount(rearLeft, PP_REAR_LEFT));
 
-        generator.packet.data.FronLeftAndRearRight.front_left = GetByteFromBarCount(frontLeft, PP_FRONT_LEFT);
-        generator.packet.data.FronLeftAndRearRight.rear_right = GetByteFromBarCount(rearRight, PP_REAR_RIGHT);
+        CanParkingAidSignals::SetFrontLeft(data, GetByteFromBarCount(frontLeft, PP_FRONT_LEFT));
+        CanParkingAidSignals::SetRearRight(data, GetByteFromBarCount(rearRight, PP_REAR_RIGHT));
 
-        //generator.packet.data.FrontAndFrontRight.front = GetByteFromBarCount(front, PP_FRONT);
-        //generator.packet.data.FrontAndFrontRight.front_right = GetByteFromBarCount(front, PP_FRONT_RIGHT);
+        //CanParkingAidSignals::SetFront(data, GetByteFromBarCount(front, PP_FRONT));
+        //CanParkingAidSignals::SetFrontRight(data, GetByteFromBarCount(front, PP_FRONT_RIGHT));
 
-        generator.packet.data.FrontAndFrontRight.front = 7;
-        generator.packet.data.FrontAndFrontRight.front_right = 7;
-        generator.packet.data.FrontAndFrontRight.show = 1;
+        CanParkingAidSignals::SetFront(data, 7);
+        CanParkingAidSignals::SetFrontRight(data, 7);
+        CanParkingAidSignals::SetShow(data, 1);
 
-        unsigned char* serializedPacket = generator.GetSerializedPacket();
-        canMessageSender->SendMessage(CAN_ID_PARKING_AID, 0, sizeof(CanParkingAidPacket), serializedPacket);
+        canMessageSender->SendMessage(CAN_ID_PARKING_AID, 0, sizeof(data), data);
     }
 };
 #pragma endregion
@@ -6,6 +6,7 @@
 
 #include "../AbstractCanMessageSender.h"
 #include "../../Helpers/PacketGenerator.h"
+#include "../../Helpers/BitField.h"
 
 // CANID: 165
 const uint16_t CAN_ID_RADIO = 0x165;
@@ -51,6 +52,10 @@ union CanRadioPacket {
     uint8_t CanRadioPacket[sizeof(CanRadioStruct)];
 };
 
+// fields read straight from a received message
+typedef BitField<0, 7, 1> CanRadioEnabledField;
+typedef BitField<2, 4, 3> CanRadioSourceField;
+
 #pragma region Sender class
 class CanRadioPacketSender
 {
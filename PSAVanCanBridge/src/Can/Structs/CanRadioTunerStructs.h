@@ -6,6 +6,7 @@
 
 #include "../AbstractCanMessageSender.h"
 #include "../../Helpers/PacketGenerator.h"
+#include "../../Helpers/BitField.h"
 
 // CANID: 225
 const uint16_t CAN_ID_RADIO_TUNER = 0x225;
@@ -78,6 +79,11 @@ union CanRadioTunerPacket {
     uint8_t CanRadioTunerPacket[sizeof(CanRadioTunerStruct)];
 };
 
+// fields read straight from a received message
+typedef BitField<2, 4, 3> CanRadioTunerBandField;
+typedef BitField<3, 0, 8> CanRadioTunerFrequency1Field;
+typedef BitField<4, 0, 8> CanRadioTunerFrequency2Field;
+
 unsigned int GetCanRadioFrequencyToDisplay(float frequency)
 {
     return round((frequency - 50) / 0.05);
@@ -5,7 +5,7 @@
     #define _CanSpeedAndRpmStructs_h
 
 #include "../AbstractCanMessageSender.h"
-#include "../../Helpers/PacketGenerator.h"
+#include "../Generated/CanSignals.h"
 
 // CANID: 0B6
 const uint16_t CAN_ID_SPEED_AND_RPM = 0x0B6;
@@ -51,16 +51,15 @@ class CanSpeedAndRpmPacketSender
 
     void Send(uint8_t speed, uint16_t rpm, uint16_t distance)
     {
-        PacketGenerator<CanSpeedAndRpmPacket> generator;
+        uint8_t data[CanSpeedAndRpmSignals::LENGTH] = { 0 };
 
-        generator.packet.data.Rpm.Data = SwapLoByteWithHiByte(rpm * 8);
-        generator.packet.data.Speed.Data = SwapLoByteWithHiByte(speed * 100);
-        generator.packet.data.Odometer.Data = distance;
-        generator.packet.data.FuelConsumptionCounter = 0x89;
-        generator.packet.data.Field4 = 0xD0;
+        CanSpeedAndRpmSignals::SetRpm(data, rpm);
+        CanSpeedAndRpmSignals::SetSpeed(data, speed);
+        CanSpeedAndRpmSignals::SetOdometer(data, distance);
+        CanSpeedAndRpmSignals::SetFuelConsumptionCounter(data, 0x89);
+        CanSpeedAndRpmSignals::SetField4(data, 0xD0);
 
-        unsigned char *serializedPacket = generator.GetSerializedPacket();
-        canMessageSender->SendMessage(CAN_ID_SPEED_AND_RPM, 0, sizeof(CanSpeedAndRpmPacket), serializedPacket);
+        canMessageSender->SendMessage(CAN_ID_SPEED_AND_RPM, 0, sizeof(data), data);
     }
 };
 #pragma endregion
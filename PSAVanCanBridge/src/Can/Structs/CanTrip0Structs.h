@@ -5,8 +5,7 @@
     #define _CanTrip0Structs_h
 
 #include "../AbstractCanMessageSender.h"
-#include "../../Helpers/PacketGenerator.h"
-#include "../../Helpers/IntValueOnTwoBytes.h"
+#include "../Generated/CanSignals.h"
 
 // CANID: 221
 const uint16_t CAN_ID_TRIP0 = 0x221;
@@ -76,26 +75,14 @@ class CanTrip0PacketSender
 
     void SendTripInfo(int kmToGasStation, int lper100km, int kmtoFinish, uint8_t button)
     {
-        PacketGenerator<CanTrip0Packet> generator;
+        uint8_t data[CanTrip0Signals::LENGTH] = { 0 };
 
-        generator.packet.data.Information.trip_switch_pressed = button;
+        CanTrip0Signals::SetTripSwitchPressed(data, button);
+        CanTrip0Signals::SetKmToGasStation(data, kmToGasStation);
+        CanTrip0Signals::SetLitersPer100Km(data, lper100km);
+        CanTrip0Signals::SetKmToFinish(data, kmtoFinish);
 
-        IntValueOnTwoBytes intValueOnTwoBytes;
-
-        intValueOnTwoBytes.value = kmToGasStation;
-        generator.packet.data.KmToGasStationByte1 = intValueOnTwoBytes.bytes[1];
-        generator.packet.data.KmToGasStationByte2 = intValueOnTwoBytes.bytes[0];
-
-        intValueOnTwoBytes.value = lper100km;
-        generator.packet.data.LitersPer100KmByte1 = intValueOnTwoBytes.bytes[1];
-        generator.packet.data.LitersPer100KmByte2 = intValueOnTwoBytes.bytes[0];
-
-        intValueOnTwoBytes.value = kmtoFinish * 10;
-        generator.packet.data.KmToFinishByte1 = intValueOnTwoBytes.bytes[1];
-        generator.packet.data.KmToFinishByte2 = intValueOnTwoBytes.bytes[0];
-
-        unsigned char *serializedPacket = generator.GetSerializedPacket();
-        canMessageSender->SendMessage(CAN_ID_TRIP0, 0, sizeof(CanTrip0Packet), serializedPacket);
+        canMessageSender->SendMessage(CAN_ID_TRIP0, 0, sizeof(data), data);
     }
 
 };
@@ -0,0 +1,99 @@
+// BitField.h
+#pragma once
+
+#ifndef _BitField_h
+    #define _BitField_h
+
+#include <stdint.h>
+
+const bool BIT_FIELD_BIG_ENDIAN = true;
+const bool BIT_FIELD_LITTLE_ENDIAN = false;
+
+/* Smallest unsigned type holding a field of the given width */
+template <uint8_t Width, bool FitsInByte = (Width <= 8), bool FitsInWord = (Width <= 16)> struct BitFieldValueType { typedef uint32_t Type; };
+template <uint8_t Width> struct BitFieldValueType<Width, false, true> { typedef uint16_t Type; };
+template <uint8_t Width> struct BitFieldValueType<Width, true, true> { typedef uint8_t Type; };
+
+/* Reads and writes a value made of whole bytes, unrolled at compile time */
+template <uint8_t ByteCount, bool BigEndian> struct BitFieldBytes {
+    static uint32_t Read(const uint8_t data[])
+    {
+        return BigEndian
+            ? (uint32_t)data[0] << (8 * (ByteCount - 1)) | BitFieldBytes<ByteCount - 1, BigEndian>::Read(data + 1)
+            : data[0] | BitFieldBytes<ByteCount - 1, BigEndian>::Read(data + 1) << 8;
+    }
+
+    static void Write(uint8_t data[], uint32_t value)
+    {
+        if (BigEndian)
+        {
+            data[0] = (uint8_t)(value >> (8 * (ByteCount - 1)));
+        }
+        else
+        {
+            data[0] = (uint8_t)value;
+            value >>= 8;
+        }
+        BitFieldBytes<ByteCount - 1, BigEndian>::Write(data + 1, value);
+    }
+};
+
+template <bool BigEndian> struct BitFieldBytes<1, BigEndian> {
+    static uint32_t Read(const uint8_t data[])
+    {
+        return data[0];
+    }
+
+    static void Write(uint8_t data[], uint32_t value)
+    {
+        data[0] = (uint8_t)value;
+    }
+};
+
+/*
+    Describes where a field sits in a packet, so it can be read straight from the received bytes
+    (or written into the bytes to send) with a single load, shift and mask instead of copying the
+    packet into a struct of bitfields.
+    A field either fits into one byte (bits are numbered from the least significant one, as in the
+    comments of the packet structs) or is made of whole bytes in the given byte order.
+*/
+template <uint8_t ByteOffset, uint8_t BitOffset, uint8_t Width, bool BigEndian = BIT_FIELD_BIG_ENDIAN>
+struct BitField {
+    static_assert(Width > 0 && Width <= 32, "a bit field must be 1 to 32 bits wide");
+    static_assert(BitOffset + Width <= 8 || (BitOffset == 0 && Width % 8 == 0), "a bit field must fit into one byte or be made of whole bytes");
+
+    typedef typename BitFieldValueType<Width>::Type ValueType;
+
+    const static uint8_t BYTE_OFFSET = ByteOffset;
+    const static uint8_t BIT_OFFSET = BitOffset;
+    const static uint8_t WIDTH = Width;
+    const static uint8_t BYTE_COUNT = Width <= 8 ? 1 : Width / 8;
+    const static uint32_t MASK = Width == 32 ? 0xFFFFFFFF : (1UL << Width) - 1;
+
+    /* Returns true if a packet of the given length contains the whole field */
+    static constexpr bool IsInside(uint8_t length)
+    {
+        return ByteOffset + BYTE_COUNT <= length;
+    }
+
+    static ValueType Get(const uint8_t data[])
+    {
+        if (BYTE_COUNT == 1)
+        {
+            return (data[ByteOffset] >> BitOffset) & MASK;
+        }
+        return BitFieldBytes<BYTE_COUNT, BigEndian>::Read(data + ByteOffset);
+    }
+
+    static void Set(uint8_t data[], ValueType value)
+    {
+        if (BYTE_COUNT == 1)
+        {
+            data[ByteOffset] = (data[ByteOffset] & ~(MASK << BitOffset)) | ((value & MASK) << BitOffset);
+            return;
+        }
+        BitFieldBytes<BYTE_COUNT, BigEndian>::Write(data + ByteOffset, value);
+    }
+};
+
+#endif
@@ -0,0 +1,52 @@
+// BridgeEvent.h
+#pragma once
+
+#ifndef _BridgeEvent_h
+    #define _BridgeEvent_h
+
+#include <stdint.h>
+
+enum BridgeEventType : uint8_t {
+    // a frame of the radio remote, Button and Scroll hold the raw bytes
+    BRIDGE_EVENT_RADIO_REMOTE,
+    BRIDGE_EVENT_TRIP_BUTTON_PRESSED,
+    BRIDGE_EVENT_TRIP_RESET,
+    // Popup holds the message to show
+    BRIDGE_EVENT_POPUP_RAISED,
+    // the escape button was pressed on the head unit
+    BRIDGE_EVENT_POPUP_HIDE_REQUESTED,
+    BRIDGE_EVENT_SEAT_BELT_WARNING_RESET,
+    BRIDGE_EVENT_PASSENGER_AIRBAG_DISABLED,
+    BRIDGE_EVENT_AUTOMATIC_HEADLAMP_ENABLED,
+    BRIDGE_EVENT_AUTOMATIC_HEADLAMP_DISABLED,
+    BRIDGE_EVENT_AUTOMATIC_DOOR_LOCKING_ENABLED,
+    BRIDGE_EVENT_GEARBOX_FAULT,
+    BRIDGE_EVENT_ENGINE_FAULT_REPAIR_NEEDED,
+    // a RD4/43/45 head unit is on the bus
+    BRIDGE_EVENT_HEAD_UNIT_DETECTED,
+    // sent once when the ignition is switched off, the CAN state is reset to a clean state
+    BRIDGE_EVENT_IGNITION_OFF
+};
+
+/* The fields of CanDisplayPopupItem which differ between the popups, the rest is filled in when it is queued */
+struct BridgeEventPopup {
+    uint8_t Category;
+    uint8_t MessageType;
+    uint8_t DoorStatus1;
+    uint8_t DoorStatus2;
+    uint8_t VANByte;
+};
+
+/* A one-shot action the VAN side (or any other task) asks the CAN side to do */
+struct BridgeEvent {
+    BridgeEventType Type;
+    union {
+        struct {
+            uint8_t Button;
+            uint8_t Scroll;
+        } RadioRemote;
+        BridgeEventPopup Popup;
+    };
+};
+
+#endif
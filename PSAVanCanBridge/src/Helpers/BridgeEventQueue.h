@@ -0,0 +1,108 @@
+// BridgeEventQueue.h
+#pragma once
+
+#ifndef _BridgeEventQueue_h
+    #define _BridgeEventQueue_h
+
+#include <stdint.h>
+#include <atomic>
+
+#include "BridgeEvent.h"
+
+/*
+    Carries BridgeEvents from the tasks on both cores to the single task owning the CAN handlers.
+    Bounded and lock-free: every slot has a sequence number telling whether it is free for the next producer or filled
+    for the consumer, the producers claim slots with a compare-and-swap. Push() never waits, if the queue is full the event
+    is dropped and counted. Any number of tasks may call Push(), only the owner task may call Pop().
+*/
+class BridgeEventQueue
+{
+    // must be a power of two
+    const static uint8_t QUEUE_LENGTH = 32;
+
+    struct Slot {
+        std::atomic<uint32_t> Sequence;
+        BridgeEvent Event;
+    };
+
+    Slot slots[QUEUE_LENGTH];
+    std::atomic<uint32_t> pushPosition;
+    // only the consumer uses it
+    uint32_t popPosition = 0;
+
+    std::atomic<uint32_t> droppedCount;
+
+public:
+    BridgeEventQueue() : pushPosition(0), droppedCount(0)
+    {
+        for (uint8_t i = 0; i < QUEUE_LENGTH; i++)
+        {
+            slots[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /* Returns false if the queue was full and the event was dropped */
+    bool Push(const BridgeEvent& event)
+    {
+        uint32_t position = pushPosition.load(std::memory_order_relaxed);
+        Slot* slot;
+
+        for (;;)
+        {
+            slot = &slots[position & (QUEUE_LENGTH - 1)];
+            const int32_t difference = (int32_t)(slot->Sequence.load(std::memory_order_acquire) - position);
+
+            if (difference == 0)
+            {
+                // the slot is free, claim it unless another producer was faster
+                if (pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // the consumer didn't free this slot yet
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                position = pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->Event = event;
+        slot->Sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Push(BridgeEventType type)
+    {
+        BridgeEvent event;
+        event.Type = type;
+        return Push(event);
+    }
+
+    /* Returns false if there is no event */
+    bool Pop(BridgeEvent& event)
+    {
+        Slot* slot = &slots[popPosition & (QUEUE_LENGTH - 1)];
+        if (slot->Sequence.load(std::memory_order_acquire) != popPosition + 1)
+        {
+            return false;
+        }
+
+        event = slot->Event;
+        slot->Sequence.store(popPosition + QUEUE_LENGTH, std::memory_order_release);
+        popPosition++;
+        return true;
+    }
+
+    uint32_t GetDroppedCount()
+    {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+};
+
+#endif
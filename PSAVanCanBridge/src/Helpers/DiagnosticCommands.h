@@ -0,0 +1,88 @@
+// DiagnosticCommands.h
+#pragma once
+
+#ifndef _DiagnosticCommands_h
+    #define _DiagnosticCommands_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WProgram.h"
+#endif
+
+#include "BridgeEventQueue.h"
+#include "../SerialPort/AbstractSerial.h"
+#include "../Van/VanHandlerContainer.h"
+#include "../Van/VanTrafficStatistics.h"
+#include "../Can/CanHeartbeatScheduler.h"
+#include "../Can/CanTransmitQueue.h"
+#include "TaskProfiler.h"
+#include "MemoryReport.h"
+
+/*
+    The serial commands which only print a report. They don't send anything to the buses, so unlike the rest of the
+    commands of the SerialReader they are read whenever READ_SERIAL_PORT_FOR_DIAGNOSTICS is set, in the car as well.
+*/
+class DiagnosticCommands {
+    AbsSer* _serialPort;
+    BridgeEventQueue* _events;
+    VanHandlerContainer* _vanHandlerContainer;
+    VanTrafficStatistics* _vanTrafficStatistics;
+    CanHeartbeatScheduler* _canHeartbeatScheduler;
+    CanTransmitQueue* _canTransmitQueue;
+    TaskProfiler* _taskProfiler;
+    MemoryReport* _memoryReport;
+
+public:
+    DiagnosticCommands(
+        AbsSer* serialPort,
+        BridgeEventQueue* eventQueue,
+        VanHandlerContainer* vanHandlerContainer,
+        VanTrafficStatistics* vanTrafficStatistics,
+        CanHeartbeatScheduler* canHeartbeatScheduler,
+        CanTransmitQueue* canTransmitQueue,
+        TaskProfiler* taskProfiler,
+        MemoryReport* memoryReport)
+    {
+        _serialPort = serialPort;
+        _events = eventQueue;
+        _vanHandlerContainer = vanHandlerContainer;
+        _vanTrafficStatistics = vanTrafficStatistics;
+        _canHeartbeatScheduler = canHeartbeatScheduler;
+        _canTransmitQueue = canTransmitQueue;
+        _taskProfiler = taskProfiler;
+        _memoryReport = memoryReport;
+    }
+
+    /* Prints the report of the command, returns false if the character is not a diagnostic command */
+    bool Handle(uint8_t command)
+    {
+        switch (command)
+        {
+            case 'H':
+                _vanHandlerContainer->PrintPayloadCacheStatistics(_serialPort);
+                return true;
+            case 'F':
+                _vanTrafficStatistics->Print(_serialPort, micros());
+                return true;
+            case 'J':
+                _canHeartbeatScheduler->Print(_serialPort);
+                return true;
+            case 'Q':
+                _canTransmitQueue->Print(_serialPort);
+                _serialPort->print("bridge events dropped ");
+                _serialPort->println(_events->GetDroppedCount());
+                return true;
+            case 'P':
+                _taskProfiler->Print(_serialPort);
+                return true;
+            case 'R':
+                _memoryReport->Print(_serialPort);
+                return true;
+            default:
+                return false;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,116 @@
+// LookupTable.h
+#pragma once
+
+#ifndef _LookupTable_h
+    #define _LookupTable_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+    Mapping tables generated at compile time. The mapping is written as a list of key-value pairs, MakeLookupTable() turns it
+    into an array indexed by the key, so a lookup is a single read. Declared as constexpr at namespace scope the tables are
+    placed into flash (rodata) and cost neither RAM nor startup time.
+*/
+
+struct LookupEntry {
+    uint8_t Key;
+    uint8_t Value;
+};
+
+template <size_t Size>
+struct LookupTable {
+    uint8_t Values[Size];
+
+    constexpr uint8_t Get(uint8_t key) const
+    {
+        return Values[key];
+    }
+};
+
+template <size_t... Indexes>
+struct LookupIndexSequence {};
+
+template <size_t Count, size_t... Indexes>
+struct MakeLookupIndexSequence : MakeLookupIndexSequence<Count - 1, Count - 1, Indexes...> {};
+
+template <size_t... Indexes>
+struct MakeLookupIndexSequence<0, Indexes...> : LookupIndexSequence<Indexes...> {};
+
+/* Returns the value of the key or defaultValue if the key is not in the list */
+template <size_t Count>
+constexpr uint8_t FindLookupValue(const LookupEntry (&entries)[Count], size_t key, uint8_t defaultValue, size_t index = 0)
+{
+    return index == Count
+        ? defaultValue
+        : entries[index].Key == key
+            ? entries[index].Value
+            : FindLookupValue(entries, key, defaultValue, index + 1);
+}
+
+template <size_t Count>
+constexpr bool ContainsLookupKey(const LookupEntry (&entries)[Count], uint8_t key, size_t index = 0)
+{
+    return index == Count
+        ? false
+        : entries[index].Key == key || ContainsLookupKey(entries, key, index + 1);
+}
+
+/* Used in static_asserts, a key listed twice is a copy-paste error, only one of the values would be used */
+template <size_t Count>
+constexpr bool HasDuplicateLookupKey(const LookupEntry (&entries)[Count], size_t index = 0)
+{
+    return index == Count
+        ? false
+        : ContainsLookupKey(entries, entries[index].Key, index + 1) || HasDuplicateLookupKey(entries, index + 1);
+}
+
+template <size_t Count>
+constexpr bool ContainsLookupValue(const LookupEntry (&entries)[Count], uint8_t value, size_t index = 0)
+{
+    return index == Count
+        ? false
+        : entries[index].Value == value || ContainsLookupValue(entries, value, index + 1);
+}
+
+/* The number of different values in the list, several keys can be mapped to the same value */
+template <size_t Count>
+constexpr size_t CountDistinctLookupValues(const LookupEntry (&entries)[Count], size_t index = 0)
+{
+    return index == Count
+        ? 0
+        : (ContainsLookupValue(entries, entries[index].Value, index + 1) ? 0 : 1) + CountDistinctLookupValues(entries, index + 1);
+}
+
+/* Used in static_asserts, true if every key of the first list is in the second one */
+template <size_t Count, size_t OtherCount>
+constexpr bool ContainsAllLookupKeys(const LookupEntry (&entries)[Count], const LookupEntry (&otherEntries)[OtherCount], size_t index = 0)
+{
+    return index == Count
+        ? true
+        : ContainsLookupKey(otherEntries, entries[index].Key) && ContainsAllLookupKeys(entries, otherEntries, index + 1);
+}
+
+/* Used in static_asserts, true if every key fits into a table of the given size */
+template <size_t Count>
+constexpr bool AreLookupKeysBelow(const LookupEntry (&entries)[Count], size_t size, size_t index = 0)
+{
+    return index == Count
+        ? true
+        : entries[index].Key < size && AreLookupKeysBelow(entries, size, index + 1);
+}
+
+template <size_t Size, size_t Count, size_t... Indexes>
+constexpr LookupTable<Size> MakeLookupTable(const LookupEntry (&entries)[Count], uint8_t defaultValue, LookupIndexSequence<Indexes...>)
+{
+    return LookupTable<Size> { { FindLookupValue(entries, Indexes, defaultValue)... } };
+}
+
+/* The keys missing from the list get defaultValue */
+template <size_t Size, size_t Count>
+constexpr LookupTable<Size> MakeLookupTable(const LookupEntry (&entries)[Count], uint8_t defaultValue)
+{
+    return MakeLookupTable<Size>(entries, defaultValue, MakeLookupIndexSequence<Size>());
+}
+
+#endif
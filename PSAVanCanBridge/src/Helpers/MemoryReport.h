@@ -0,0 +1,123 @@
+// MemoryReport.h
+#pragma once
+
+#ifndef _MemoryReport_h
+    #define _MemoryReport_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WProgram.h"
+#endif
+
+#include <esp_heap_caps.h>
+
+#include "../SerialPort/AbstractSerial.h"
+#include "TaskProfiler.h"
+
+/* The static RAM of a group of objects, the size is known at build time */
+struct MemorySection {
+    const char* Name;
+    size_t Size;
+};
+
+/*
+    Shows where the DRAM goes: the static sections, the internal heap and the stack every task used so far.
+    The stacks of the tasks are sized from these numbers, so they are logged periodically while driving as well,
+    the high-water marks only grow with the code paths the tasks have been through.
+*/
+class MemoryReport
+{
+    const static uint8_t MAX_SECTION_COUNT = 8;
+    // heap allocations of the bridge, the Bluetooth and the FreeRTOS stacks come from the internal RAM
+    const static uint32_t HEAP_CAPABILITIES = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+
+    TaskProfiler* _taskProfiler;
+    unsigned long _logInterval;
+
+    MemorySection sections[MAX_SECTION_COUNT];
+    uint8_t sectionCount = 0;
+
+    unsigned long previousLogTime = 0;
+
+    void PrintLine(AbsSer* serialPort, const char* name, uint32_t value1, uint32_t value2, uint32_t value3)
+    {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%-16s %8u %8u %8u", name, (unsigned)value1, (unsigned)value2, (unsigned)value3);
+        serialPort->println(buffer);
+    }
+
+    void PrintLine(AbsSer* serialPort, const char* name, uint32_t value)
+    {
+        char buffer[48];
+        snprintf(buffer, sizeof(buffer), "%-16s %8u", name, (unsigned)value);
+        serialPort->println(buffer);
+    }
+
+public:
+    /* logInterval is in milliseconds, 0 turns off the periodic log */
+    MemoryReport(TaskProfiler* taskProfiler, unsigned long logInterval)
+    {
+        _taskProfiler = taskProfiler;
+        _logInterval = logInterval;
+    }
+
+    void AddStaticSection(const char* name, size_t size)
+    {
+        if (sectionCount < MAX_SECTION_COUNT)
+        {
+            sections[sectionCount].Name = name;
+            sections[sectionCount].Size = size;
+            sectionCount++;
+        }
+    }
+
+    void Print(AbsSer* serialPort)
+    {
+        size_t staticSize = 0;
+        serialPort->println("static           bytes");
+        for (uint8_t i = 0; i < sectionCount; i++)
+        {
+            PrintLine(serialPort, sections[i].Name, sections[i].Size);
+            staticSize += sections[i].Size;
+        }
+        PrintLine(serialPort, "total", staticSize);
+
+        serialPort->println("heap                 free min_free  largest");
+        PrintLine(
+            serialPort,
+            "internal",
+            heap_caps_get_free_size(HEAP_CAPABILITIES),
+            heap_caps_get_minimum_free_size(HEAP_CAPABILITIES),
+            heap_caps_get_largest_free_block(HEAP_CAPABILITIES));
+
+        // the stack sizes and the high-water marks are in bytes on the ESP32
+        uint32_t stackSize = 0;
+        uint32_t stackFree = 0;
+        serialPort->println("stack                size min_free     used");
+        for (uint8_t i = 0; i < _taskProfiler->GetTaskCount(); i++)
+        {
+            const TaskProfile& profile = _taskProfiler->GetProfile(i);
+            const uint32_t minFree = _taskProfiler->GetStackHighWaterMark(i);
+
+            PrintLine(serialPort, profile.Name, profile.StackSize, minFree, profile.StackSize - minFree);
+            stackSize += profile.StackSize;
+            stackFree += minFree;
+        }
+        PrintLine(serialPort, "total", stackSize, stackFree, stackSize - stackFree);
+    }
+
+    /* Called from the loop, prints the report once in every log interval */
+    void Log(AbsSer* serialPort, unsigned long currentTime)
+    {
+        if (_logInterval == 0 || currentTime - previousLogTime < _logInterval)
+        {
+            return;
+        }
+        previousLogTime = currentTime;
+
+        Print(serialPort);
+    }
+};
+
+#endif
@@ -11,14 +11,14 @@ class PacketGenerator
 {
     public:
         PacketGenerator();
-        ~PacketGenerator();
 
         T packet;
 
+        /* The returned buffer belongs to the generator and is valid while the generator exists */
         uint8_t* GetSerializedPacket();
 
     private:
-        uint8_t* serializedPacket;
+        uint8_t serializedPacket[sizeof(T)];
 };
 
 template <class T>
@@ -27,16 +27,9 @@ PacketGenerator<T>::PacketGenerator()
     memset(&packet, 0, sizeof(packet));
 }
 
-template <class T>
-PacketGenerator<T>::~PacketGenerator()
-{
-    memset(&packet, 0, 0);
-    delete[] serializedPacket;
-}
-
 template <class T>
 uint8_t* PacketGenerator<T>::GetSerializedPacket() {
-    serializedPacket = Serialize<T>(packet);
+    Serialize<T>(packet, serializedPacket);
     return serializedPacket;
 }
 
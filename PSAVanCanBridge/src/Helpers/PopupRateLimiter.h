@@ -0,0 +1,94 @@
+// PopupRateLimiter.h
+#pragma once
+
+#ifndef _PopupRateLimiter_h
+    #define _PopupRateLimiter_h
+
+#include <stdint.h>
+
+/*
+    Lets a popup type through at most once in every chill time. Instead of a timestamp for all 256 types it remembers the
+    types shown recently, only a few dozen types exist.
+    A type which is not remembered behaves as if it was shown at 0, like the zeroed timestamps of a full table would.
+    A slot is reused only when the chill time of its type is over, forgetting such a type changes no decision.
+    With a slot for every type that can occur (see CanDisplayPopupHandler3) this is always possible. If it isn't, because
+    more types are in their chill time than there are slots, the slot of the oldest one is taken: that type can then be
+    shown again before its chill time is over.
+*/
+template <uint8_t Capacity>
+class PopupRateLimiter
+{
+    static_assert(Capacity > 0, "the popup rate limiter needs at least one slot");
+
+    const unsigned long _chillTime;
+
+    uint8_t popupTypes[Capacity];
+    unsigned long shownTimes[Capacity];
+    uint8_t count = 0;
+
+    uint8_t FindSlot(uint8_t popupType)
+    {
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (popupTypes[i] == popupType)
+            {
+                return i;
+            }
+        }
+        return Capacity;
+    }
+
+    uint8_t GetFreeSlot(unsigned long currentTime)
+    {
+        if (count < Capacity)
+        {
+            return count++;
+        }
+
+        uint8_t oldest = 0;
+        for (uint8_t i = 0; i < Capacity; i++)
+        {
+            if (currentTime - shownTimes[i] > _chillTime)
+            {
+                return i;
+            }
+            if (currentTime - shownTimes[i] > currentTime - shownTimes[oldest])
+            {
+                oldest = i;
+            }
+        }
+        return oldest;
+    }
+
+public:
+    PopupRateLimiter(unsigned long chillTime) : _chillTime(chillTime)
+    {
+    }
+
+    /* Returns true and starts the chill time of the type if it can be shown now */
+    bool TryShow(uint8_t popupType, unsigned long currentTime)
+    {
+        uint8_t slot = FindSlot(popupType);
+        const unsigned long previousTime = slot == Capacity ? 0 : shownTimes[slot];
+
+        if (currentTime - previousTime <= _chillTime)
+        {
+            return false;
+        }
+
+        if (slot == Capacity)
+        {
+            slot = GetFreeSlot(currentTime);
+            popupTypes[slot] = popupType;
+        }
+        shownTimes[slot] = currentTime;
+        return true;
+    }
+
+    void Reset()
+    {
+        count = 0;
+    }
+};
+
+#endif
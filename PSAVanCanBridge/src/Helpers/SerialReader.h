@@ -11,54 +11,110 @@
 
 #include "../../Config.h"
 #include "../Can/AbstractCanMessageSender.h"
-#include "../Can/Handlers/CanTripInfoHandler.h"
+#include "BridgeEventQueue.h"
 #include "../Can/Structs/CanMenuStructs.h"
 #include "../Helpers/IVinFlashStorage.h"
 #include "../SerialPort/AbstractSerial.h"
+#include "../Van/VanFrameRing.h"
+#include "../Can/CanFrameSequence.h"
+#include "DiagnosticCommands.h"
 
+struct SerialVanFrame {
+    uint8_t Length;
+    uint8_t Data[VAN_RAW_FRAME_MAX_LENGTH];
+};
+
+/*
+    Reads the serial port in the loop task, at the lowest priority: the commands print long tables and must not hold up the
+    VAN receive task. The VAN frames sent to the serial port (prefixed by 'v') are handed over to the VAN receive task in
+    a FreeRTOS queue, Receive() only takes them from there.
+    The reports are printed by the DiagnosticCommands, the rest of the commands send frames or change the settings.
+*/
 class SerialReader {
+    // room for the frames of two button presses
+    const static uint8_t RADIO_BUTTON_SEQUENCE_LENGTH = 6;
+    const static uint8_t VAN_FRAME_QUEUE_LENGTH = 8;
+
     AbsSer* _serialPort;
     AbstractCanMessageSender* _CANInterface;
-    CanTripInfoHandler* _tripInfoHandler;
-    CanRadioButtonPacketSender* _canRadioButtonSender;
+    BridgeEventQueue* _events;
+    CanFrameSequence _radioButtonSequence;
+    CanFrameSequenceWriter _radioButtonSequenceWriter;
+    CanRadioButtonPacketSender _canRadioButtonSender;
     IVinFlashStorage* _vinFlashStorage;
+    DiagnosticCommands* _diagnosticCommands;
+
+    QueueHandle_t vanFrames;
 
     void SendRadioButton(uint8_t button)
     {
         uint8_t sendCount = 2;
         for (int i = 0; i < sendCount; ++i)
         {
-            _canRadioButtonSender->SendButtonCode(button);
+            _canRadioButtonSender.SendButtonCode(button);
         }
-        _canRadioButtonSender->SendButtonCode(0);
+        _canRadioButtonSender.SendButtonCode(0);
     }
 
 public:
     SerialReader(
         AbsSer* serialPort, 
         AbstractCanMessageSender* CANInterface,
-        CanTripInfoHandler* tripInfoHandler,
-        CanRadioButtonPacketSender* canRadioButtonSender,
-        IVinFlashStorage* vinFlashStorage
-    )
+        BridgeEventQueue* eventQueue,
+        IVinFlashStorage* vinFlashStorage,
+        DiagnosticCommands* diagnosticCommands
+    ) :
+        // the button frames are sent by the CAN transmit task, so reading the serial port doesn't wait for them
+        _radioButtonSequence(CANInterface, RADIO_BUTTON_SEQUENCE_LENGTH),
+        _radioButtonSequenceWriter(&_radioButtonSequence, 1, 0),
+        _canRadioButtonSender(&_radioButtonSequenceWriter)
     {
         _serialPort = serialPort;
         _CANInterface = CANInterface;
-        _tripInfoHandler = tripInfoHandler;
-        _canRadioButtonSender = canRadioButtonSender;
+        _events = eventQueue;
         _vinFlashStorage = vinFlashStorage;
+        _diagnosticCommands = diagnosticCommands;
+
+        vanFrames = xQueueCreate(VAN_FRAME_QUEUE_LENGTH, sizeof(SerialVanFrame));
+    }
+
+    CanFrameSequence* GetFrameSequence()
+    {
+        return &_radioButtonSequence;
     }
 
+    /* Called by the VAN receive task, returns a frame read from the serial port or a length of 0 */
     void Receive(uint8_t* messageLength, uint8_t message[])
     {
-        uint8_t vanMessageLength = 0;
-        if (_serialPort->available() > 0) {
+        SerialVanFrame frame;
+        if (xQueueReceive(vanFrames, &frame, 0) != pdTRUE)
+        {
+            *messageLength = 0;
+            return;
+        }
+        memcpy(message, frame.Data, frame.Length);
+        *messageLength = frame.Length;
+    }
+
+    /* Called from the loop, handles everything received since the previous call */
+    void Process()
+    {
+        while (_serialPort->available() > 0) {
             uint8_t inChar = (uint8_t)_serialPort->read();
             if (inChar == 'v') { // got a sync byte?
-                while (_serialPort->available()) {
-                    message[vanMessageLength] = _serialPort->read();
-                    vanMessageLength++;
+                SerialVanFrame frame;
+                frame.Length = 0;
+                while (_serialPort->available() && frame.Length < VAN_RAW_FRAME_MAX_LENGTH) {
+                    frame.Data[frame.Length] = _serialPort->read();
+                    frame.Length++;
                 }
+                // dropped if the VAN receive task is behind
+                xQueueSend(vanFrames, &frame, 0);
+            }
+
+            if (READ_SERIAL_PORT_FOR_DIAGNOSTICS && _diagnosticCommands->Handle(inChar))
+            {
+                continue;
             }
 
             if (READ_SERIAL_PORT_FOR_COMMANDS)
@@ -123,12 +179,11 @@ class SerialReader {
 
                     for (int i = 0; i < 10; ++i)
                     {
-                        _tripInfoHandler->TripButtonPress();
+                        _events->Push(BRIDGE_EVENT_TRIP_BUTTON_PRESSED);
                     }
                 }
             }
         }
-        *messageLength = vanMessageLength;
     }
 };
 
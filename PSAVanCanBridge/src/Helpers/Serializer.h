@@ -17,13 +17,11 @@ template <class T> T DeSerialize(const uint8_t b[])
     return tmp;
 }
 
-template <class T> uint8_t* Serialize(const T& packet)
+/* Writes the packet into a buffer of the caller, which must hold sizeof(T) bytes. Nothing is allocated, so it can be used on every send. */
+template <class T> void Serialize(const T& packet, uint8_t* buffer)
 {
     //https://stackoverflow.com/a/14760796/5453350
-    uint8_t* b = new unsigned char[sizeof(packet)];
-    memcpy(b, &packet, sizeof(packet));//convert to byte array
-
-    return b;
+    memcpy(buffer, &packet, sizeof(packet));//convert to byte array
 }
 
 #endif
@@ -0,0 +1,93 @@
+// SharedSnapshot.h
+#pragma once
+
+#ifndef _SharedSnapshot_h
+    #define _SharedSnapshot_h
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+/*
+    Hands a struct from one writer task to reader tasks running on the other core without tearing (seqlock).
+    The writer fills its own working copy and publishes it with Write(), which never waits.
+    Readers take a consistent copy with Read() once per cycle. A reader only repeats the copy if a Write() happened at the same time,
+    so it never blocks the writer and never waits for anything but the few microseconds of a struct copy.
+    Only one task may call Write(), and a reader on the writer's core must not have a higher priority than the writer
+    (it would spin while the write it interrupted can't finish).
+*/
+template <class T>
+class SharedSnapshot {
+    // odd while a write is in progress
+    std::atomic<uint32_t> sequence;
+    T data;
+
+public:
+    SharedSnapshot() : sequence(0), data()
+    {
+    }
+
+    void Write(const T& value)
+    {
+        const uint32_t currentSequence = sequence.load(std::memory_order_relaxed);
+
+        sequence.store(currentSequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        memcpy(&data, &value, sizeof(T));
+
+        sequence.store(currentSequence + 2, std::memory_order_release);
+    }
+
+    void Read(T& value) const
+    {
+        uint32_t sequenceBefore;
+        uint32_t sequenceAfter;
+
+        do
+        {
+            sequenceBefore = sequence.load(std::memory_order_acquire);
+            if (sequenceBefore & 1)
+            {
+                continue;
+            }
+
+            memcpy(&value, &data, sizeof(T));
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            sequenceAfter = sequence.load(std::memory_order_relaxed);
+        } while ((sequenceBefore & 1) || sequenceBefore != sequenceAfter);
+    }
+
+    /* Returns the number of times the snapshot was written */
+    uint32_t GetVersion() const
+    {
+        return sequence.load(std::memory_order_acquire) / 2;
+    }
+};
+
+/*
+    The copy of a SharedSnapshot one reader task works with during a cycle.
+    Every reader task owns its own view: Take() refreshes the copy once at the start of the cycle and returns it by const reference,
+    the task passes that reference down to its senders. The copy doesn't change until the next Take() of the same task,
+    so the senders never see a state changing in the middle of a cycle and nothing copies the struct again.
+    The reference must not be kept beyond the cycle, and a view must not be shared between tasks.
+*/
+template <class T>
+class SharedSnapshotView {
+    const SharedSnapshot<T>& _snapshot;
+    T data;
+
+public:
+    SharedSnapshotView(const SharedSnapshot<T>& snapshot) : _snapshot(snapshot), data()
+    {
+    }
+
+    const T& Take()
+    {
+        _snapshot.Read(data);
+        return data;
+    }
+};
+
+#endif
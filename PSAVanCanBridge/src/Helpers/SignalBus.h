@@ -0,0 +1,132 @@
+// SignalBus.h
+#pragma once
+
+#ifndef _SignalBus_h
+    #define _SignalBus_h
+
+#include <stdint.h>
+
+#include "SharedSnapshot.h"
+
+/* Every value published on the bus, add new signals before SIGNAL_COUNT */
+enum SignalId : uint8_t {
+    SIGNAL_SPEED,
+    SIGNAL_RPM,
+    SIGNAL_DISTANCE,
+    SIGNAL_PARKING_AID_EXTERIOR_REAR_LEFT_DISTANCE,
+    SIGNAL_PARKING_AID_EXTERIOR_REAR_RIGHT_DISTANCE,
+    SIGNAL_PARKING_AID_INTERIOR_REAR_LEFT_DISTANCE,
+    SIGNAL_PARKING_AID_INTERIOR_REAR_RIGHT_DISTANCE,
+    SIGNAL_COUNT
+};
+
+struct SignalSample {
+    int32_t Value;
+    // millis() when the value was published
+    unsigned long Timestamp;
+};
+
+/*
+    Carries single values from the VAN side to the CAN side. The storage is fixed: one slot per signal, each a SharedSnapshot,
+    so publishing never allocates and never blocks. Every signal may have only one publishing task, but a new source can
+    publish its own signals without touching the consumers of the others.
+    Consumers don't register callbacks, they read the signals they are interested in with a SignalSubscription from their own task.
+*/
+class SignalBus
+{
+    SharedSnapshot<SignalSample> samples[SIGNAL_COUNT];
+
+public:
+    void Publish(SignalId signal, int32_t value, unsigned long timestamp)
+    {
+        SignalSample sample;
+        sample.Value = value;
+        sample.Timestamp = timestamp;
+        samples[signal].Write(sample);
+    }
+
+    /* Returns false if the signal was never published */
+    bool Read(SignalId signal, SignalSample& sample) const
+    {
+        samples[signal].Read(sample);
+        return samples[signal].GetVersion() > 0;
+    }
+
+    /* Increases with every Publish() of the signal */
+    uint32_t GetVersion(SignalId signal) const
+    {
+        return samples[signal].GetVersion();
+    }
+};
+
+/*
+    The signals one consumer uses. Update() copies the signals published since the previous call,
+    Get() returns them by their index in the list given to the constructor.
+*/
+template <uint8_t Count>
+class SignalSubscription
+{
+    const SignalBus* _signalBus;
+    SignalId signals[Count];
+    uint32_t versions[Count];
+    SignalSample samples[Count];
+
+public:
+    SignalSubscription(const SignalBus* signalBus, const SignalId (&signalIds)[Count])
+    {
+        _signalBus = signalBus;
+        for (uint8_t i = 0; i < Count; i++)
+        {
+            signals[i] = signalIds[i];
+            versions[i] = 0;
+            samples[i].Value = 0;
+            samples[i].Timestamp = 0;
+        }
+    }
+
+    /* Returns true if any of the signals was published since the previous call */
+    bool Update()
+    {
+        bool isChanged = false;
+        for (uint8_t i = 0; i < Count; i++)
+        {
+            const uint32_t version = _signalBus->GetVersion(signals[i]);
+            if (version != versions[i])
+            {
+                _signalBus->Read(signals[i], samples[i]);
+                versions[i] = version;
+                isChanged = true;
+            }
+        }
+        return isChanged;
+    }
+
+    const SignalSample& Get(uint8_t index) const
+    {
+        return samples[index];
+    }
+
+    int32_t GetValue(uint8_t index) const
+    {
+        return samples[index].Value;
+    }
+
+    /*
+        Returns true if every signal was published in the last maxAge milliseconds. A sample published after currentTime
+        was taken (by another task, between reading the clock and Update()) counts as fresh, the signed difference keeps
+        it from wrapping around to a huge age.
+    */
+    bool IsFresh(unsigned long currentTime, unsigned long maxAge) const
+    {
+        for (uint8_t i = 0; i < Count; i++)
+        {
+            if (versions[i] == 0 || (long)(currentTime - samples[i].Timestamp) > (long)maxAge)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,44 @@
+// StaticInstance.h
+#pragma once
+
+#ifndef _StaticInstance_h
+    #define _StaticInstance_h
+
+#include <stdint.h>
+#include <new>
+#include <utility>
+
+/*
+    Static storage for one object which can only be constructed at runtime, for example in setup() after the hardware it uses is initialized.
+    The object is placed into the storage instead of the heap, so it is counted in the static RAM of the build and is never freed.
+*/
+template <class T>
+class StaticInstance
+{
+    alignas(T) uint8_t storage[sizeof(T)];
+    T* instance = nullptr;
+
+public:
+    const static size_t SIZE = sizeof(T);
+
+    /* Constructs the object with the given arguments, must be called only once */
+    template <class... Args>
+    T* Create(Args&&... args)
+    {
+        instance = new (storage) T(std::forward<Args>(args)...);
+        return instance;
+    }
+
+    /* Returns nullptr if the object was not created */
+    T* Get() const
+    {
+        return instance;
+    }
+
+    T* operator->() const
+    {
+        return instance;
+    }
+};
+
+#endif
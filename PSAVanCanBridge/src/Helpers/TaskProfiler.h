@@ -0,0 +1,212 @@
+// TaskProfiler.h
+#pragma once
+
+#ifndef _TaskProfiler_h
+    #define _TaskProfiler_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WProgram.h"
+#endif
+
+#include <atomic>
+
+#include "../SerialPort/AbstractSerial.h"
+
+/* Where and how a task of the bridge runs */
+struct TaskProfile {
+    const char* Name;
+    TaskFunction_t Function;
+    uint32_t StackSize;
+    UBaseType_t Priority;
+    BaseType_t Core;
+    // cycle time in milliseconds, 0 for tasks which are woken up by an event
+    uint16_t Period;
+    TaskHandle_t* Handle;
+};
+
+struct TaskStatistics {
+    uint32_t CycleCount;
+    // in microseconds
+    uint32_t RunTimeSum;
+    uint32_t MaxRunTime;
+    // time from the deadline (periodic tasks) or from Trigger() (event tasks) until the task ran, in microseconds
+    uint32_t LatencySum;
+    uint32_t LatencyCount;
+    uint32_t MaxLatency;
+};
+
+/*
+    Creates the tasks from a profile table and measures them: how long a cycle runs, how late the task wakes up
+    and how much of its stack was never used. Every task updates only its own statistics, Print() reads them
+    without locking as they are only informational.
+*/
+class TaskProfiler
+{
+    const static uint8_t MAX_TASK_COUNT = 8;
+
+    const TaskProfile* _profiles = nullptr;
+    uint8_t _taskCount = 0;
+
+    TaskStatistics statistics[MAX_TASK_COUNT];
+    uint32_t cycleStartTime[MAX_TASK_COUNT];
+    // 0 if the task wasn't triggered since its last cycle
+    std::atomic<uint32_t> triggerTime[MAX_TASK_COUNT];
+
+    void StartCycle(uint8_t taskIndex, uint32_t currentTime, bool hasLatency, uint32_t latency)
+    {
+        cycleStartTime[taskIndex] = currentTime;
+
+        if (hasLatency)
+        {
+            TaskStatistics& taskStatistics = statistics[taskIndex];
+            taskStatistics.LatencySum += latency;
+            taskStatistics.LatencyCount++;
+            if (latency > taskStatistics.MaxLatency)
+            {
+                taskStatistics.MaxLatency = latency;
+            }
+        }
+    }
+
+public:
+    TaskProfiler()
+    {
+        for (uint8_t i = 0; i < MAX_TASK_COUNT; i++)
+        {
+            memset(&statistics[i], 0, sizeof(TaskStatistics));
+            cycleStartTime[i] = 0;
+            triggerTime[i] = 0;
+        }
+    }
+
+    /* Creates the tasks in the order of the table */
+    void CreateTasks(const TaskProfile profiles[], uint8_t taskCount)
+    {
+        _profiles = profiles;
+        _taskCount = taskCount < MAX_TASK_COUNT ? taskCount : MAX_TASK_COUNT;
+
+        for (uint8_t i = 0; i < _taskCount; i++)
+        {
+            xTaskCreatePinnedToCore(
+                _profiles[i].Function,
+                _profiles[i].Name,
+                _profiles[i].StackSize,
+                NULL,
+                _profiles[i].Priority,
+                _profiles[i].Handle,
+                _profiles[i].Core);
+        }
+    }
+
+    uint8_t GetTaskCount()
+    {
+        return _taskCount;
+    }
+
+    const TaskProfile& GetProfile(uint8_t taskIndex)
+    {
+        return _profiles[taskIndex];
+    }
+
+    /* Returns the cycle time of the task in ticks */
+    TickType_t GetPeriod(uint8_t taskIndex)
+    {
+        return _profiles[taskIndex].Period / portTICK_PERIOD_MS;
+    }
+
+    /* Called by the task which wakes up an event task, right before notifying it */
+    void Trigger(uint8_t taskIndex)
+    {
+        uint32_t notTriggered = 0;
+        // keep the first trigger, the latency is measured from the oldest pending event
+        triggerTime[taskIndex].compare_exchange_strong(notTriggered, micros() | 1, std::memory_order_relaxed);
+    }
+
+    /* Called by an event task when it wakes up */
+    void BeginCycle(uint8_t taskIndex)
+    {
+        const uint32_t currentTime = micros();
+        const uint32_t triggeredAt = triggerTime[taskIndex].exchange(0, std::memory_order_relaxed);
+
+        const uint32_t latency = (int32_t)(currentTime - triggeredAt) > 0 ? currentTime - triggeredAt : 0;
+
+        StartCycle(taskIndex, currentTime, triggeredAt != 0, latency);
+    }
+
+    /* Called by a periodic task when it wakes up, deadline is the wake time vTaskDelayUntil() waited for */
+    void BeginCycle(uint8_t taskIndex, TickType_t deadline)
+    {
+        const uint32_t currentTime = micros();
+        const TickType_t lateTicks = xTaskGetTickCount() - deadline;
+
+        StartCycle(taskIndex, currentTime, true, lateTicks * portTICK_PERIOD_MS * 1000);
+    }
+
+    void EndCycle(uint8_t taskIndex)
+    {
+        const uint32_t runTime = micros() - cycleStartTime[taskIndex];
+
+        TaskStatistics& taskStatistics = statistics[taskIndex];
+        taskStatistics.CycleCount++;
+        taskStatistics.RunTimeSum += runTime;
+        if (runTime > taskStatistics.MaxRunTime)
+        {
+            taskStatistics.MaxRunTime = runTime;
+        }
+    }
+
+    const TaskStatistics& GetStatistics(uint8_t taskIndex)
+    {
+        return statistics[taskIndex];
+    }
+
+    /* Returns the smallest amount of free stack the task ever had */
+    uint32_t GetStackHighWaterMark(uint8_t taskIndex)
+    {
+        return uxTaskGetStackHighWaterMark(*_profiles[taskIndex].Handle);
+    }
+
+    void Print(AbsSer* serialPort)
+    {
+        serialPort->println("task core priority period stack free_stack cycles avg_run_us max_run_us avg_latency_us max_latency_us");
+
+        for (uint8_t i = 0; i < _taskCount; i++)
+        {
+            const TaskProfile& profile = _profiles[i];
+            const TaskStatistics& taskStatistics = statistics[i];
+
+            serialPort->print(profile.Name);
+            serialPort->print(" ");
+            serialPort->print(profile.Core);
+            serialPort->print(" ");
+            serialPort->print(profile.Priority);
+            serialPort->print(" ");
+            serialPort->print(profile.Period);
+            serialPort->print(" ");
+            serialPort->print(profile.StackSize);
+            serialPort->print(" ");
+            serialPort->print(GetStackHighWaterMark(i));
+            serialPort->print(" ");
+            serialPort->print(taskStatistics.CycleCount);
+            serialPort->print(" ");
+            serialPort->print(taskStatistics.CycleCount > 0 ? taskStatistics.RunTimeSum / taskStatistics.CycleCount : 0);
+            serialPort->print(" ");
+            serialPort->print(taskStatistics.MaxRunTime);
+            serialPort->print(" ");
+            if (taskStatistics.LatencyCount > 0)
+            {
+                serialPort->print(taskStatistics.LatencySum / taskStatistics.LatencyCount);
+                serialPort->print(" ");
+                serialPort->println(taskStatistics.MaxLatency);
+            }
+            else
+            {
+                serialPort->println("- -");
+            }
+        }
+    }
+};
+
+#endif
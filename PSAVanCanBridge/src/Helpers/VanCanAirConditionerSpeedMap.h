@@ -4,27 +4,41 @@
 #ifndef _VanCanAirConditionerSpeedMap_h
     #define _VanCanAirConditionerSpeedMap_h
 
+#include "LookupTable.h"
+
+/* The reported fan speed has some very weird logic. It reports different bytes for the same value based on whether the AC is on, the rear window heating is enabled and 
+    the air recycling is on. I could not figure out any formula or masking to get the real value, so I chose the brute force version: 
+    I created mapping arrays and choose the correct one based on the criterias.
+    Every array maps the VAN byte to the fan speed (1-8), the recycling doesn't change the bytes unless the rear window heating is on.
+*/
+constexpr LookupEntry AIR_CONDITIONER_AC_SPEEDS[] = { { 0x04, 1 }, { 0x05, 2 }, { 0x06, 3 }, { 0x07, 4 }, { 0x08, 5 }, { 0x0A, 6 }, { 0x0C, 7 }, { 0x0E, 8 } };
+constexpr LookupEntry AIR_CONDITIONER_AC_REAR_WINDOW_SPEEDS[] = { { 0x12, 1 }, { 0x13, 2 }, { 0x14, 3 }, { 0x15, 4 }, { 0x16, 5 }, { 0x18, 6 }, { 0x1A, 7 }, { 0x1C, 8 } };
+constexpr LookupEntry AIR_CONDITIONER_AC_REAR_WINDOW_RECYCLE_SPEEDS[] = { { 0x18, 1 }, { 0x19, 2 }, { 0x20, 3 }, { 0x21, 4 }, { 0x22, 5 }, { 0x24, 6 }, { 0x26, 7 }, { 0x28, 8 } };
+constexpr LookupEntry AIR_CONDITIONER_ECO_SPEEDS[] = { { 0x02, 1 }, { 0x03, 2 }, { 0x04, 3 }, { 0x05, 4 }, { 0x06, 5 }, { 0x08, 6 }, { 0x0A, 7 }, { 0x0C, 8 } };
+constexpr LookupEntry AIR_CONDITIONER_ECO_REAR_WINDOW_SPEEDS[] = { { 0x10, 1 }, { 0x11, 2 }, { 0x12, 3 }, { 0x13, 4 }, { 0x14, 5 }, { 0x16, 6 }, { 0x18, 7 }, { 0x1A, 8 } };
+constexpr LookupEntry AIR_CONDITIONER_ECO_REAR_WINDOW_RECYCLE_SPEEDS[] = { { 0x16, 1 }, { 0x17, 2 }, { 0x18, 3 }, { 0x19, 4 }, { 0x20, 5 }, { 0x22, 6 }, { 0x24, 7 }, { 0x26, 8 } };
+
+static_assert(!HasDuplicateLookupKey(AIR_CONDITIONER_AC_SPEEDS), "a fan speed byte is listed twice");
+static_assert(!HasDuplicateLookupKey(AIR_CONDITIONER_AC_REAR_WINDOW_SPEEDS), "a fan speed byte is listed twice");
+static_assert(!HasDuplicateLookupKey(AIR_CONDITIONER_AC_REAR_WINDOW_RECYCLE_SPEEDS), "a fan speed byte is listed twice");
+static_assert(!HasDuplicateLookupKey(AIR_CONDITIONER_ECO_SPEEDS), "a fan speed byte is listed twice");
+static_assert(!HasDuplicateLookupKey(AIR_CONDITIONER_ECO_REAR_WINDOW_SPEEDS), "a fan speed byte is listed twice");
+static_assert(!HasDuplicateLookupKey(AIR_CONDITIONER_ECO_REAR_WINDOW_RECYCLE_SPEEDS), "a fan speed byte is listed twice");
+
+// indexed by the VAN byte, 0 is an unknown byte
+constexpr LookupTable<256> AIR_CONDITIONER_SPEED_TABLES[6] = {
+    MakeLookupTable<256>(AIR_CONDITIONER_AC_SPEEDS, 0),
+    MakeLookupTable<256>(AIR_CONDITIONER_AC_REAR_WINDOW_SPEEDS, 0),
+    MakeLookupTable<256>(AIR_CONDITIONER_AC_REAR_WINDOW_RECYCLE_SPEEDS, 0),
+    MakeLookupTable<256>(AIR_CONDITIONER_ECO_SPEEDS, 0),
+    MakeLookupTable<256>(AIR_CONDITIONER_ECO_REAR_WINDOW_SPEEDS, 0),
+    MakeLookupTable<256>(AIR_CONDITIONER_ECO_REAR_WINDOW_RECYCLE_SPEEDS, 0),
+};
+
 class VanCanAirConditionerSpeedMap
 {
-    /* The reported fan speed has some very weird logic. It reports different bytes for the same value based on whether the AC is on, the rear window heating is enabled and 
-        the air recycling is on. I could not figure out any formula or masking to get the real value, so I chose the brute force version: 
-        I created mapping arrays and choose the correct one based on the criterias.
-    */
-
-    const uint8_t AcMap[8]                   = { 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0E };
-    //const uint8_t AcRecycleMap[8]            = { 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0E };
-    const uint8_t AcRearWindowMap[8]         = { 0x12, 0x13, 0x14, 0x15, 0x16, 0x18, 0x1A, 0x1C };
-    const uint8_t AcRearWindowRecycleMap[8]  = { 0x18, 0x19, 0x20, 0x21, 0x22, 0x24, 0x26, 0x28 };
-
-    const uint8_t ecoMap[8]                  = { 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0C };
-    //const uint8_t ecoRecycleMap[8]           = { 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0C };
-    const uint8_t ecoRearWindowMap[8]        = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x16, 0x18, 0x1A };
-    const uint8_t ecoRearWindowRecycleMap[8] = { 0x16, 0x17, 0x18, 0x19, 0x20, 0x22, 0x24, 0x26 };
-
-    const uint8_t *arrayToUse;
-
     private:
-        uint8_t previousSpeed;
+        uint8_t previousSpeed = 0;
     public:
         VanCanAirConditionerSpeedMap()
         {
@@ -32,45 +46,17 @@ class VanCanAirConditionerSpeedMap
 
         uint8_t GetFanSpeedFromVANByte(uint8_t vanByte, uint8_t isAcOn, uint8_t isRearWindowHeatingOn, uint8_t isRecycleOn)
         {
-            uint8_t result = previousSpeed;
-
-            if (isAcOn == 1 && isRearWindowHeatingOn == 0 && (isRecycleOn == 0 || isRecycleOn == 1))
-            {
-                arrayToUse = AcMap;
-            }
-            if (isAcOn == 1 && isRearWindowHeatingOn == 1 && isRecycleOn == 0)
-            {
-                arrayToUse = AcRearWindowMap;
-            }
-            if (isAcOn == 1 && isRearWindowHeatingOn == 1 && isRecycleOn == 1)
-            {
-                arrayToUse = AcRearWindowRecycleMap;
-            }
-
-            if (isAcOn == 0 && isRearWindowHeatingOn == 0 && (isRecycleOn == 0 || isRecycleOn == 1))
-            {
-                arrayToUse = ecoMap;
-            }
-            if (isAcOn == 0 && isRearWindowHeatingOn == 1 && isRecycleOn == 0)
-            {
-                arrayToUse = ecoRearWindowMap;
-            }
-            if (isAcOn == 0 && isRearWindowHeatingOn == 1 && isRecycleOn == 1)
-            {
-                arrayToUse = ecoRearWindowRecycleMap;
-            }
+            const uint8_t tableIndex =
+                (isAcOn == 1 ? 0 : 3) +
+                (isRearWindowHeatingOn == 1 ? 1 + (isRecycleOn == 1) : 0);
 
-            for (uint8_t i = 0; i < 8; i++)
+            const uint8_t speed = AIR_CONDITIONER_SPEED_TABLES[tableIndex].Get(vanByte);
+            if (speed != 0)
             {
-                if (*(arrayToUse + i) == vanByte)
-                {
-                    result = i + 1;
-                    previousSpeed = result;
-                    break;
-                }
+                previousSpeed = speed;
             }
 
-            return result;
+            return previousSpeed;
         }
 };
 
@@ -1,56 +1,66 @@
 #include "VanCanGearboxPositionMap.h"
+#include "LookupTable.h"
 #include "../Can/Structs/CanDash2Structs.h"
 #include "../Van/Structs/VanInstrumentClusterV2Structs.h"
 
-void VanCanGearboxPositionMap::SetGearboxMapping()
-{
-    memset(_gearBoxMap, CAN_DASH_GEAR_INVALID, 15);
-    _gearBoxMap[VAN_GEAR_V2_P] = CAN_DASH_GEAR_P;
-    _gearBoxMap[VAN_GEAR_V2_R] = CAN_DASH_GEAR_R;
-    _gearBoxMap[VAN_GEAR_V2_N] = CAN_DASH_GEAR_N;
-    _gearBoxMap[VAN_GEAR_V2_D] = CAN_DASH_GEAR_D;
-    _gearBoxMap[VAN_GEAR_V2_4] = CAN_DASH_GEAR_4;
-    _gearBoxMap[VAN_GEAR_V2_3] = CAN_DASH_GEAR_3;
-    _gearBoxMap[VAN_GEAR_V2_2] = CAN_DASH_GEAR_2;
-    _gearBoxMap[VAN_GEAR_V2_1] = CAN_DASH_GEAR_1;
-}
+namespace {
+    constexpr LookupEntry GEARBOX_POSITIONS[] = {
+        { VAN_GEAR_V2_P, CAN_DASH_GEAR_P },
+        { VAN_GEAR_V2_R, CAN_DASH_GEAR_R },
+        { VAN_GEAR_V2_N, CAN_DASH_GEAR_N },
+        { VAN_GEAR_V2_D, CAN_DASH_GEAR_D },
+        { VAN_GEAR_V2_4, CAN_DASH_GEAR_4 },
+        { VAN_GEAR_V2_3, CAN_DASH_GEAR_3 },
+        { VAN_GEAR_V2_2, CAN_DASH_GEAR_2 },
+        { VAN_GEAR_V2_1, CAN_DASH_GEAR_1 },
+    };
 
-void VanCanGearboxPositionMap::SetGearboxModeMapping()
-{
-    memset(_gearBoxModeMap, CAN_DASH_GEAR_MODE_AUTO, 4);
-    _gearBoxModeMap[VAN_GEAR_MODE_V2_NORMAL]              = CAN_DASH_GEAR_MODE_AUTO;
-    _gearBoxModeMap[VAN_GEAR_MODE_V2_AUTO_ECO]            = CAN_DASH_GEAR_MODE_AUTO;
-    _gearBoxModeMap[VAN_GEAR_MODE_V2_SPORT]               = CAN_DASH_GEAR_MODE_AUTO_SPORT;
-    _gearBoxModeMap[VAN_GEAR_MODE_V2_SEQUENTIAL_ECO]      = CAN_DASH_GEAR_MODE_SEQUENTIAL;
-    _gearBoxModeMap[VAN_GEAR_MODE_V2_SNOW_AUTO]           = CAN_DASH_GEAR_MODE_AUTO_SNOW;
-    _gearBoxModeMap[VAN_GEAR_MODE_V2_SNOW_AUTO_ECO]       = CAN_DASH_GEAR_MODE_AUTO_SNOW;
-    _gearBoxModeMap[VAN_GEAR_MODE_V2_SNOW_SEQUENTIAL]     = CAN_DASH_GEAR_MODE_AUTO_SNOW;
-    _gearBoxModeMap[VAN_GEAR_MODE_V2_SNOW_SEQUENTIAL_ECO] = CAN_DASH_GEAR_MODE_AUTO_SNOW;
-}
+    constexpr LookupEntry GEARBOX_MODES[] = {
+        { VAN_GEAR_MODE_V2_NORMAL,              CAN_DASH_GEAR_MODE_AUTO },
+        { VAN_GEAR_MODE_V2_AUTO_ECO,            CAN_DASH_GEAR_MODE_AUTO },
+        { VAN_GEAR_MODE_V2_SPORT,               CAN_DASH_GEAR_MODE_AUTO_SPORT },
+        { VAN_GEAR_MODE_V2_SEQUENTIAL_ECO,      CAN_DASH_GEAR_MODE_SEQUENTIAL },
+        { VAN_GEAR_MODE_V2_SNOW_AUTO,           CAN_DASH_GEAR_MODE_AUTO_SNOW },
+        { VAN_GEAR_MODE_V2_SNOW_AUTO_ECO,       CAN_DASH_GEAR_MODE_AUTO_SNOW },
+        { VAN_GEAR_MODE_V2_SNOW_SEQUENTIAL,     CAN_DASH_GEAR_MODE_AUTO_SNOW },
+        { VAN_GEAR_MODE_V2_SNOW_SEQUENTIAL_ECO, CAN_DASH_GEAR_MODE_AUTO_SNOW },
+    };
 
-void VanCanGearboxPositionMap::SetGearboxSelectionMapping()
-{
-    _gearBoxSelectionMap[VAN_GEAR_V2_SELECTION_BVA] = CAN_DASH_GEAR_SELECTION_BVA;
-    _gearBoxSelectionMap[VAN_GEAR_V2_SELECTION_BVM] = CAN_DASH_GEAR_SELECTION_BVM;
-}
+    constexpr LookupEntry GEARBOX_SELECTIONS[] = {
+        { VAN_GEAR_V2_SELECTION_BVA, CAN_DASH_GEAR_SELECTION_BVA },
+        { VAN_GEAR_V2_SELECTION_BVM, CAN_DASH_GEAR_SELECTION_BVM },
+    };
 
-VanCanGearboxPositionMap::VanCanGearboxPositionMap()
-{
-    SetGearboxMapping();
-    SetGearboxModeMapping();
+    const uint8_t GEARBOX_POSITION_COUNT = 16;
+    const uint8_t GEARBOX_MODE_COUNT = 8;
+    const uint8_t GEARBOX_SELECTION_COUNT = 2;
+
+    static_assert(!HasDuplicateLookupKey(GEARBOX_POSITIONS), "a VAN gearbox position is mapped twice");
+    static_assert(!HasDuplicateLookupKey(GEARBOX_MODES), "a VAN gearbox mode is mapped twice");
+    static_assert(!HasDuplicateLookupKey(GEARBOX_SELECTIONS), "a VAN gearbox selection is mapped twice");
+    static_assert(AreLookupKeysBelow(GEARBOX_POSITIONS, GEARBOX_POSITION_COUNT), "a VAN gearbox position doesn't fit into the table");
+    // every mode and selection the VAN bits can hold must be mapped
+    static_assert(sizeof(GEARBOX_MODES) / sizeof(GEARBOX_MODES[0]) == GEARBOX_MODE_COUNT, "a VAN gearbox mode is missing");
+    static_assert(sizeof(GEARBOX_SELECTIONS) / sizeof(GEARBOX_SELECTIONS[0]) == GEARBOX_SELECTION_COUNT, "a VAN gearbox selection is missing");
+    static_assert(AreLookupKeysBelow(GEARBOX_MODES, GEARBOX_MODE_COUNT), "a VAN gearbox mode doesn't fit into the table");
+    static_assert(AreLookupKeysBelow(GEARBOX_SELECTIONS, GEARBOX_SELECTION_COUNT), "a VAN gearbox selection doesn't fit into the table");
+
+    constexpr LookupTable<GEARBOX_POSITION_COUNT> GEARBOX_POSITION_TABLE = MakeLookupTable<GEARBOX_POSITION_COUNT>(GEARBOX_POSITIONS, CAN_DASH_GEAR_INVALID);
+    constexpr LookupTable<GEARBOX_MODE_COUNT> GEARBOX_MODE_TABLE = MakeLookupTable<GEARBOX_MODE_COUNT>(GEARBOX_MODES, CAN_DASH_GEAR_MODE_AUTO);
+    constexpr LookupTable<GEARBOX_SELECTION_COUNT> GEARBOX_SELECTION_TABLE = MakeLookupTable<GEARBOX_SELECTION_COUNT>(GEARBOX_SELECTIONS, CAN_DASH_GEAR_SELECTION_BVA);
 }
 
 uint8_t VanCanGearboxPositionMap::GetGearboxPositionFromVanPosition(uint8_t gearboxPosition)
 {
-    return _gearBoxMap[gearboxPosition];
+    return GEARBOX_POSITION_TABLE.Get(gearboxPosition);
 }
 
 uint8_t VanCanGearboxPositionMap::GetGearboxModeFromVanMode(uint8_t gearboxMode)
 {
-    return _gearBoxModeMap[gearboxMode];
+    return GEARBOX_MODE_TABLE.Get(gearboxMode);
 }
 
 uint8_t VanCanGearboxPositionMap::GetGearboxSelectionFromVanSelection(uint8_t gearboxSelection)
 {
-    return _gearBoxSelectionMap[gearboxSelection];
+    return GEARBOX_SELECTION_TABLE.Get(gearboxSelection);
 }
@@ -9,8 +9,6 @@
 
 struct VanDataToBridgeToCan
 {
-    uint8_t Speed = 0;
-    uint16_t Rpm = 0;
     uint16_t Trip1Distance = 0;
     uint8_t Trip1Speed = 0;
     uint16_t Trip1Consumption = 0;
@@ -40,6 +38,5 @@ struct VanDataToBridgeToCan
     uint8_t GearboxPosition = 0;
     uint8_t GearboxMode = 0;
     uint8_t GearboxSelection = 0;
-    uint16_t Distance = 0;
 };
 #endif
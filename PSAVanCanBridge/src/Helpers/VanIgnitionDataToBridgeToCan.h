@@ -18,11 +18,6 @@ struct VanIgnitionDataToBridgeToCan
     uint8_t LeftStickButtonPressed = 0;
     uint8_t IsReverseEngaged = 0;
     uint8_t IsTrailerPresent = 0;
-    uint8_t ExteriorRearLeftDistanceInCm = 0xFF;
-    uint8_t ExteriorRearRightDistanceInCm = 0xFF;
-    uint8_t InteriorRearLeftDistanceInCm = 0xFF;
-    uint8_t InteriorRearRightDistanceInCm = 0xFF;
-    uint8_t HaveDataFromParkingAid = 0;
     uint8_t LowBeamOn = 0;
     uint8_t TripButtonPressed = 0;
 };
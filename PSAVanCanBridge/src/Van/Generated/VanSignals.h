@@ -0,0 +1,735 @@
+// VanSignals.h
+// Generated by tools/generate_signals.py from schema/signals.json, do not edit by hand
+#pragma once
+
+#ifndef _VanSignals_h
+    #define _VanSignals_h
+
+#include <stdint.h>
+
+#include "../../Helpers/BitField.h"
+
+// VAN 0x824
+struct VanSpeedAndRpmSignals {
+    const static uint16_t IDENT = 0x824;
+    const static uint8_t LENGTH = 7;
+
+    // Rpm: bytes 0-1 big endian, value = raw / 8, raw 0xFFFF reads as 0
+    typedef BitField<0, 0, 16, BIT_FIELD_BIG_ENDIAN> RpmField;
+
+    static uint16_t GetRpmRaw(const uint8_t data[])
+    {
+        return RpmField::Get(data);
+    }
+
+    static void SetRpmRaw(uint8_t data[], uint16_t raw)
+    {
+        RpmField::Set(data, raw);
+    }
+
+    static uint16_t GetRpm(const uint8_t data[])
+    {
+        const uint16_t raw = GetRpmRaw(data);
+        if (raw == 0xFFFF)
+        {
+            return 0;
+        }
+        return (uint16_t)(raw / 8);
+    }
+
+    static void SetRpm(uint8_t data[], uint16_t value)
+    {
+        SetRpmRaw(data, (uint16_t)((int32_t)value * 8));
+    }
+
+    // Speed: bytes 2-3 big endian, value = raw / 100, raw 0xFFFF reads as 0
+    typedef BitField<2, 0, 16, BIT_FIELD_BIG_ENDIAN> SpeedField;
+
+    static uint16_t GetSpeedRaw(const uint8_t data[])
+    {
+        return SpeedField::Get(data);
+    }
+
+    static void SetSpeedRaw(uint8_t data[], uint16_t raw)
+    {
+        SpeedField::Set(data, raw);
+    }
+
+    static uint16_t GetSpeed(const uint8_t data[])
+    {
+        const uint16_t raw = GetSpeedRaw(data);
+        if (raw == 0xFFFF)
+        {
+            return 0;
+        }
+        return (uint16_t)(raw / 100);
+    }
+
+    static void SetSpeed(uint8_t data[], uint16_t value)
+    {
+        SetSpeedRaw(data, (uint16_t)((int32_t)value * 100));
+    }
+
+    // Distance: bytes 4-5 little endian
+    typedef BitField<4, 0, 16, BIT_FIELD_LITTLE_ENDIAN> DistanceField;
+
+    static uint16_t GetDistance(const uint8_t data[])
+    {
+        return DistanceField::Get(data);
+    }
+
+    static void SetDistance(uint8_t data[], uint16_t raw)
+    {
+        DistanceField::Set(data, raw);
+    }
+
+    // Consumption: byte 6
+    typedef BitField<6, 0, 8> ConsumptionField;
+
+    static uint8_t GetConsumption(const uint8_t data[])
+    {
+        return ConsumptionField::Get(data);
+    }
+
+    static void SetConsumption(uint8_t data[], uint8_t raw)
+    {
+        ConsumptionField::Set(data, raw);
+    }
+};
+
+// VAN 0x8A4
+struct VanDashboardSignals {
+    const static uint16_t IDENT = 0x8A4;
+    const static uint8_t LENGTH = 7;
+
+    // Brightness: byte 0 bits 0-3
+    typedef BitField<0, 0, 4> BrightnessField;
+
+    static uint8_t GetBrightness(const uint8_t data[])
+    {
+        return BrightnessField::Get(data);
+    }
+
+    static void SetBrightness(uint8_t data[], uint8_t raw)
+    {
+        BrightnessField::Set(data, raw);
+    }
+
+    // Heartbeat: byte 0 bit 4
+    typedef BitField<0, 4, 1> HeartbeatField;
+
+    static uint8_t GetHeartbeat(const uint8_t data[])
+    {
+        return HeartbeatField::Get(data);
+    }
+
+    static void SetHeartbeat(uint8_t data[], uint8_t raw)
+    {
+        HeartbeatField::Set(data, raw);
+    }
+
+    // IsBacklightOff: byte 0 bit 7
+    typedef BitField<0, 7, 1> IsBacklightOffField;
+
+    static uint8_t GetIsBacklightOff(const uint8_t data[])
+    {
+        return IsBacklightOffField::Get(data);
+    }
+
+    static void SetIsBacklightOff(uint8_t data[], uint8_t raw)
+    {
+        IsBacklightOffField::Set(data, raw);
+    }
+
+    // AccessoriesOn: byte 1 bit 0
+    typedef BitField<1, 0, 1> AccessoriesOnField;
+
+    static uint8_t GetAccessoriesOn(const uint8_t data[])
+    {
+        return AccessoriesOnField::Get(data);
+    }
+
+    static void SetAccessoriesOn(uint8_t data[], uint8_t raw)
+    {
+        AccessoriesOnField::Set(data, raw);
+    }
+
+    // IgnitionOn: byte 1 bit 1
+    typedef BitField<1, 1, 1> IgnitionOnField;
+
+    static uint8_t GetIgnitionOn(const uint8_t data[])
+    {
+        return IgnitionOnField::Get(data);
+    }
+
+    static void SetIgnitionOn(uint8_t data[], uint8_t raw)
+    {
+        IgnitionOnField::Set(data, raw);
+    }
+
+    // EngineRunning: byte 1 bit 2
+    typedef BitField<1, 2, 1> EngineRunningField;
+
+    static uint8_t GetEngineRunning(const uint8_t data[])
+    {
+        return EngineRunningField::Get(data);
+    }
+
+    static void SetEngineRunning(uint8_t data[], uint8_t raw)
+    {
+        EngineRunningField::Set(data, raw);
+    }
+
+    // DoorOpen: byte 1 bit 3
+    typedef BitField<1, 3, 1> DoorOpenField;
+
+    static uint8_t GetDoorOpen(const uint8_t data[])
+    {
+        return DoorOpenField::Get(data);
+    }
+
+    static void SetDoorOpen(uint8_t data[], uint8_t raw)
+    {
+        DoorOpenField::Set(data, raw);
+    }
+
+    // EconomyMode: byte 1 bit 4
+    typedef BitField<1, 4, 1> EconomyModeField;
+
+    static uint8_t GetEconomyMode(const uint8_t data[])
+    {
+        return EconomyModeField::Get(data);
+    }
+
+    static void SetEconomyMode(uint8_t data[], uint8_t raw)
+    {
+        EconomyModeField::Set(data, raw);
+    }
+
+    // ReverseGear: byte 1 bit 5
+    typedef BitField<1, 5, 1> ReverseGearField;
+
+    static uint8_t GetReverseGear(const uint8_t data[])
+    {
+        return ReverseGearField::Get(data);
+    }
+
+    static void SetReverseGear(uint8_t data[], uint8_t raw)
+    {
+        ReverseGearField::Set(data, raw);
+    }
+
+    // TrailerPresent: byte 1 bit 6
+    typedef BitField<1, 6, 1> TrailerPresentField;
+
+    static uint8_t GetTrailerPresent(const uint8_t data[])
+    {
+        return TrailerPresentField::Get(data);
+    }
+
+    static void SetTrailerPresent(uint8_t data[], uint8_t raw)
+    {
+        TrailerPresentField::Set(data, raw);
+    }
+
+    // WaterTemperature: byte 2, value = (raw - 40)
+    typedef BitField<2, 0, 8> WaterTemperatureField;
+
+    static uint8_t GetWaterTemperatureRaw(const uint8_t data[])
+    {
+        return WaterTemperatureField::Get(data);
+    }
+
+    static void SetWaterTemperatureRaw(uint8_t data[], uint8_t raw)
+    {
+        WaterTemperatureField::Set(data, raw);
+    }
+
+    static int16_t GetWaterTemperature(const uint8_t data[])
+    {
+        const uint8_t raw = GetWaterTemperatureRaw(data);
+        return (int16_t)(((int32_t)raw - 40));
+    }
+
+    static void SetWaterTemperature(uint8_t data[], int16_t value)
+    {
+        SetWaterTemperatureRaw(data, (uint8_t)((int32_t)value + 40));
+    }
+
+    // Mileage: bytes 3-5 big endian
+    typedef BitField<3, 0, 24, BIT_FIELD_BIG_ENDIAN> MileageField;
+
+    static uint32_t GetMileage(const uint8_t data[])
+    {
+        return MileageField::Get(data);
+    }
+
+    static void SetMileage(uint8_t data[], uint32_t raw)
+    {
+        MileageField::Set(data, raw);
+    }
+
+    // ExternalTemperature: byte 6, value = (raw - 80) / 2
+    typedef BitField<6, 0, 8> ExternalTemperatureField;
+
+    static uint8_t GetExternalTemperatureRaw(const uint8_t data[])
+    {
+        return ExternalTemperatureField::Get(data);
+    }
+
+    static void SetExternalTemperatureRaw(uint8_t data[], uint8_t raw)
+    {
+        ExternalTemperatureField::Set(data, raw);
+    }
+
+    static int8_t GetExternalTemperature(const uint8_t data[])
+    {
+        const uint8_t raw = GetExternalTemperatureRaw(data);
+        return (int8_t)(((int32_t)raw - 80) / 2);
+    }
+
+    static void SetExternalTemperature(uint8_t data[], int8_t value)
+    {
+        SetExternalTemperatureRaw(data, (uint8_t)((int32_t)value * 2 + 80));
+    }
+};
+
+// VAN 0x564
+struct VanCarStatusSignals {
+    const static uint16_t IDENT = 0x564;
+    const static uint8_t LENGTH = 27;
+
+    // FuelFlapOpen: byte 7 bit 0
+    typedef BitField<7, 0, 1> FuelFlapOpenField;
+
+    static uint8_t GetFuelFlapOpen(const uint8_t data[])
+    {
+        return FuelFlapOpenField::Get(data);
+    }
+
+    static void SetFuelFlapOpen(uint8_t data[], uint8_t raw)
+    {
+        FuelFlapOpenField::Set(data, raw);
+    }
+
+    // SunroofOpen: byte 7 bit 1
+    typedef BitField<7, 1, 1> SunroofOpenField;
+
+    static uint8_t GetSunroofOpen(const uint8_t data[])
+    {
+        return SunroofOpenField::Get(data);
+    }
+
+    static void SetSunroofOpen(uint8_t data[], uint8_t raw)
+    {
+        SunroofOpenField::Set(data, raw);
+    }
+
+    // HoodOpen: byte 7 bit 2
+    typedef BitField<7, 2, 1> HoodOpenField;
+
+    static uint8_t GetHoodOpen(const uint8_t data[])
+    {
+        return HoodOpenField::Get(data);
+    }
+
+    static void SetHoodOpen(uint8_t data[], uint8_t raw)
+    {
+        HoodOpenField::Set(data, raw);
+    }
+
+    // BootLidOpen: byte 7 bit 3
+    typedef BitField<7, 3, 1> BootLidOpenField;
+
+    static uint8_t GetBootLidOpen(const uint8_t data[])
+    {
+        return BootLidOpenField::Get(data);
+    }
+
+    static void SetBootLidOpen(uint8_t data[], uint8_t raw)
+    {
+        BootLidOpenField::Set(data, raw);
+    }
+
+    // RearLeftDoorOpen: byte 7 bit 4
+    typedef BitField<7, 4, 1> RearLeftDoorOpenField;
+
+    static uint8_t GetRearLeftDoorOpen(const uint8_t data[])
+    {
+        return RearLeftDoorOpenField::Get(data);
+    }
+
+    static void SetRearLeftDoorOpen(uint8_t data[], uint8_t raw)
+    {
+        RearLeftDoorOpenField::Set(data, raw);
+    }
+
+    // RearRightDoorOpen: byte 7 bit 5
+    typedef BitField<7, 5, 1> RearRightDoorOpenField;
+
+    static uint8_t GetRearRightDoorOpen(const uint8_t data[])
+    {
+        return RearRightDoorOpenField::Get(data);
+    }
+
+    static void SetRearRightDoorOpen(uint8_t data[], uint8_t raw)
+    {
+        RearRightDoorOpenField::Set(data, raw);
+    }
+
+    // FrontLeftDoorOpen: byte 7 bit 6
+    typedef BitField<7, 6, 1> FrontLeftDoorOpenField;
+
+    static uint8_t GetFrontLeftDoorOpen(const uint8_t data[])
+    {
+        return FrontLeftDoorOpenField::Get(data);
+    }
+
+    static void SetFrontLeftDoorOpen(uint8_t data[], uint8_t raw)
+    {
+        FrontLeftDoorOpenField::Set(data, raw);
+    }
+
+    // FrontRightDoorOpen: byte 7 bit 7
+    typedef BitField<7, 7, 1> FrontRightDoorOpenField;
+
+    static uint8_t GetFrontRightDoorOpen(const uint8_t data[])
+    {
+        return FrontRightDoorOpenField::Get(data);
+    }
+
+    static void SetFrontRightDoorOpen(uint8_t data[], uint8_t raw)
+    {
+        FrontRightDoorOpenField::Set(data, raw);
+    }
+
+    // TripButton: byte 10 bit 0
+    typedef BitField<10, 0, 1> TripButtonField;
+
+    static uint8_t GetTripButton(const uint8_t data[])
+    {
+        return TripButtonField::Get(data);
+    }
+
+    static void SetTripButton(uint8_t data[], uint8_t raw)
+    {
+        TripButtonField::Set(data, raw);
+    }
+
+    // Trip1Speed: byte 11
+    typedef BitField<11, 0, 8> Trip1SpeedField;
+
+    static uint8_t GetTrip1Speed(const uint8_t data[])
+    {
+        return Trip1SpeedField::Get(data);
+    }
+
+    static void SetTrip1Speed(uint8_t data[], uint8_t raw)
+    {
+        Trip1SpeedField::Set(data, raw);
+    }
+
+    // Trip2Speed: byte 12
+    typedef BitField<12, 0, 8> Trip2SpeedField;
+
+    static uint8_t GetTrip2Speed(const uint8_t data[])
+    {
+        return Trip2SpeedField::Get(data);
+    }
+
+    static void SetTrip2Speed(uint8_t data[], uint8_t raw)
+    {
+        Trip2SpeedField::Set(data, raw);
+    }
+
+    // Trip1Distance: bytes 14-15 big endian
+    typedef BitField<14, 0, 16, BIT_FIELD_BIG_ENDIAN> Trip1DistanceField;
+
+    static uint16_t GetTrip1Distance(const uint8_t data[])
+    {
+        return Trip1DistanceField::Get(data);
+    }
+
+    static void SetTrip1Distance(uint8_t data[], uint16_t raw)
+    {
+        Trip1DistanceField::Set(data, raw);
+    }
+
+    // Trip1FuelConsumption: bytes 16-17 big endian
+    typedef BitField<16, 0, 16, BIT_FIELD_BIG_ENDIAN> Trip1FuelConsumptionField;
+
+    static uint16_t GetTrip1FuelConsumption(const uint8_t data[])
+    {
+        return Trip1FuelConsumptionField::Get(data);
+    }
+
+    static void SetTrip1FuelConsumption(uint8_t data[], uint16_t raw)
+    {
+        Trip1FuelConsumptionField::Set(data, raw);
+    }
+
+    // Trip2Distance: bytes 18-19 big endian
+    typedef BitField<18, 0, 16, BIT_FIELD_BIG_ENDIAN> Trip2DistanceField;
+
+    static uint16_t GetTrip2Distance(const uint8_t data[])
+    {
+        return Trip2DistanceField::Get(data);
+    }
+
+    static void SetTrip2Distance(uint8_t data[], uint16_t raw)
+    {
+        Trip2DistanceField::Set(data, raw);
+    }
+
+    // Trip2FuelConsumption: bytes 20-21 big endian
+    typedef BitField<20, 0, 16, BIT_FIELD_BIG_ENDIAN> Trip2FuelConsumptionField;
+
+    static uint16_t GetTrip2FuelConsumption(const uint8_t data[])
+    {
+        return Trip2FuelConsumptionField::Get(data);
+    }
+
+    static void SetTrip2FuelConsumption(uint8_t data[], uint16_t raw)
+    {
+        Trip2FuelConsumptionField::Set(data, raw);
+    }
+
+    // FuelConsumption: bytes 22-23 big endian
+    typedef BitField<22, 0, 16, BIT_FIELD_BIG_ENDIAN> FuelConsumptionField;
+
+    static uint16_t GetFuelConsumption(const uint8_t data[])
+    {
+        return FuelConsumptionField::Get(data);
+    }
+
+    static void SetFuelConsumption(uint8_t data[], uint16_t raw)
+    {
+        FuelConsumptionField::Set(data, raw);
+    }
+
+    // FuelLeftToPumpInKm: bytes 24-25 big endian
+    typedef BitField<24, 0, 16, BIT_FIELD_BIG_ENDIAN> FuelLeftToPumpInKmField;
+
+    static uint16_t GetFuelLeftToPumpInKm(const uint8_t data[])
+    {
+        return FuelLeftToPumpInKmField::Get(data);
+    }
+
+    static void SetFuelLeftToPumpInKm(uint8_t data[], uint16_t raw)
+    {
+        FuelLeftToPumpInKmField::Set(data, raw);
+    }
+};
+
+// VAN 0x464
+struct VanAirConditioner1Signals {
+    const static uint16_t IDENT = 0x464;
+    const static uint8_t LENGTH = 5;
+
+    // RecyclingOn: byte 0 bit 2
+    typedef BitField<0, 2, 1> RecyclingOnField;
+
+    static uint8_t GetRecyclingOn(const uint8_t data[])
+    {
+        return RecyclingOnField::Get(data);
+    }
+
+    static void SetRecyclingOn(uint8_t data[], uint8_t raw)
+    {
+        RecyclingOnField::Set(data, raw);
+    }
+
+    // AirConRequested: byte 0 bit 4
+    typedef BitField<0, 4, 1> AirConRequestedField;
+
+    static uint8_t GetAirConRequested(const uint8_t data[])
+    {
+        return AirConRequestedField::Get(data);
+    }
+
+    static void SetAirConRequested(uint8_t data[], uint8_t raw)
+    {
+        AirConRequestedField::Set(data, raw);
+    }
+
+    // FanSpeed: byte 4
+    typedef BitField<4, 0, 8> FanSpeedField;
+
+    static uint8_t GetFanSpeed(const uint8_t data[])
+    {
+        return FanSpeedField::Get(data);
+    }
+
+    static void SetFanSpeed(uint8_t data[], uint8_t raw)
+    {
+        FanSpeedField::Set(data, raw);
+    }
+};
+
+// VAN 0x4DC
+struct VanAirConditioner2Signals {
+    const static uint16_t IDENT = 0x4DC;
+    const static uint8_t LENGTH = 7;
+
+    // CompressorRunning: byte 0 bit 0
+    typedef BitField<0, 0, 1> CompressorRunningField;
+
+    static uint8_t GetCompressorRunning(const uint8_t data[])
+    {
+        return CompressorRunningField::Get(data);
+    }
+
+    static void SetCompressorRunning(uint8_t data[], uint8_t raw)
+    {
+        CompressorRunningField::Set(data, raw);
+    }
+
+    // RearWindowHeatingOn: byte 0 bit 5
+    typedef BitField<0, 5, 1> RearWindowHeatingOnField;
+
+    static uint8_t GetRearWindowHeatingOn(const uint8_t data[])
+    {
+        return RearWindowHeatingOnField::Get(data);
+    }
+
+    static void SetRearWindowHeatingOn(uint8_t data[], uint8_t raw)
+    {
+        RearWindowHeatingOnField::Set(data, raw);
+    }
+
+    // AirConOn: byte 0 bit 6
+    typedef BitField<0, 6, 1> AirConOnField;
+
+    static uint8_t GetAirConOn(const uint8_t data[])
+    {
+        return AirConOnField::Get(data);
+    }
+
+    static void SetAirConOn(uint8_t data[], uint8_t raw)
+    {
+        AirConOnField::Set(data, raw);
+    }
+
+    // PowerOn: byte 0 bit 7
+    typedef BitField<0, 7, 1> PowerOnField;
+
+    static uint8_t GetPowerOn(const uint8_t data[])
+    {
+        return PowerOnField::Get(data);
+    }
+
+    static void SetPowerOn(uint8_t data[], uint8_t raw)
+    {
+        PowerOnField::Set(data, raw);
+    }
+
+    // Pressure: byte 2
+    typedef BitField<2, 0, 8> PressureField;
+
+    static uint8_t GetPressure(const uint8_t data[])
+    {
+        return PressureField::Get(data);
+    }
+
+    static void SetPressure(uint8_t data[], uint8_t raw)
+    {
+        PressureField::Set(data, raw);
+    }
+
+    // EvaporatorTemperature: bytes 4-5 big endian, value = (raw - 400) / 10
+    typedef BitField<4, 0, 16, BIT_FIELD_BIG_ENDIAN> EvaporatorTemperatureField;
+
+    static uint16_t GetEvaporatorTemperatureRaw(const uint8_t data[])
+    {
+        return EvaporatorTemperatureField::Get(data);
+    }
+
+    static void SetEvaporatorTemperatureRaw(uint8_t data[], uint16_t raw)
+    {
+        EvaporatorTemperatureField::Set(data, raw);
+    }
+
+    static int16_t GetEvaporatorTemperature(const uint8_t data[])
+    {
+        const uint16_t raw = GetEvaporatorTemperatureRaw(data);
+        return (int16_t)(((int32_t)raw - 400) / 10);
+    }
+
+    static void SetEvaporatorTemperature(uint8_t data[], int16_t value)
+    {
+        SetEvaporatorTemperatureRaw(data, (uint16_t)((int32_t)value * 10 + 400));
+    }
+};
+
+// VAN 0xAE8
+struct VanParkingAidDiagDistanceSignals {
+    const static uint16_t IDENT = 0xAE8;
+    const static uint8_t LENGTH = 24;
+
+    // DiagFunctionId: byte 2
+    typedef BitField<2, 0, 8> DiagFunctionIdField;
+
+    static uint8_t GetDiagFunctionId(const uint8_t data[])
+    {
+        return DiagFunctionIdField::Get(data);
+    }
+
+    static void SetDiagFunctionId(uint8_t data[], uint8_t raw)
+    {
+        DiagFunctionIdField::Set(data, raw);
+    }
+
+    // ExteriorRearLeftDistanceInCm: byte 3
+    typedef BitField<3, 0, 8> ExteriorRearLeftDistanceInCmField;
+
+    static uint8_t GetExteriorRearLeftDistanceInCm(const uint8_t data[])
+    {
+        return ExteriorRearLeftDistanceInCmField::Get(data);
+    }
+
+    static void SetExteriorRearLeftDistanceInCm(uint8_t data[], uint8_t raw)
+    {
+        ExteriorRearLeftDistanceInCmField::Set(data, raw);
+    }
+
+    // ExteriorRearRightDistanceInCm: byte 4
+    typedef BitField<4, 0, 8> ExteriorRearRightDistanceInCmField;
+
+    static uint8_t GetExteriorRearRightDistanceInCm(const uint8_t data[])
+    {
+        return ExteriorRearRightDistanceInCmField::Get(data);
+    }
+
+    static void SetExteriorRearRightDistanceInCm(uint8_t data[], uint8_t raw)
+    {
+        ExteriorRearRightDistanceInCmField::Set(data, raw);
+    }
+
+    // InteriorRearLeftDistanceInCm: byte 5
+    typedef BitField<5, 0, 8> InteriorRearLeftDistanceInCmField;
+
+    static uint8_t GetInteriorRearLeftDistanceInCm(const uint8_t data[])
+    {
+        return InteriorRearLeftDistanceInCmField::Get(data);
+    }
+
+    static void SetInteriorRearLeftDistanceInCm(uint8_t data[], uint8_t raw)
+    {
+        InteriorRearLeftDistanceInCmField::Set(data, raw);
+    }
+
+    // InteriorRearRightDistanceInCm: byte 6
+    typedef BitField<6, 0, 8> InteriorRearRightDistanceInCmField;
+
+    static uint8_t GetInteriorRearRightDistanceInCm(const uint8_t data[])
+    {
+        return InteriorRearRightDistanceInCmField::Get(data);
+    }
+
+    static void SetInteriorRearRightDistanceInCm(uint8_t data[], uint8_t raw)
+    {
+        InteriorRearRightDistanceInCmField::Set(data, raw);
+    }
+};
+
+#endif
@@ -7,19 +7,30 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
+#include "../VanFrameView.h"
+#include "VanHandlerContext.h"
 
+/* Handlers with this IDENT receive every frame, regardless of its ident */
+const uint16_t VAN_IDENT_ANY = 0xFFFF;
+/* Handlers with this LENGTH receive frames of any length */
+const uint8_t VAN_LENGTH_ANY = 0xFF;
+
+/*
+    Base of the VAN message handlers. The handlers are not called through this class: the VanHandlerContainer
+    knows their concrete types from its handler list and calls them directly, so there are no virtual calls.
+    A handler has to provide:
+        const static uint16_t IDENT     the 12 bit ident of the frames it handles (or VAN_IDENT_ANY)
+        const static uint8_t LENGTH     the payload length of the frames it handles (defaults to VAN_LENGTH_ANY)
+        const static bool PROCESS_UNCHANGED_PAYLOAD
+                                        true if it needs every frame, even when the payload did not change since the last one
+                                        (edge detection, timers, state taken from other frames), defaults to false
+        a constructor taking a VanHandlerContext&
+        bool ProcessMessage(const VanFrameView& frame, VanDataToBridgeToCan *dataToBridge, VanIgnitionDataToBridgeToCan *ignitionDataToBridge, DoorStatus& doorStatus)
+*/
 class AbstractVanMessageHandler {
 public:
-    virtual bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
-        VanDataToBridgeToCan *dataToBridge,
-        VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus)
-
-    = 0; // The '= 0;' makes whole class "pure virtual"
+    const static uint8_t LENGTH = VAN_LENGTH_ANY;
+    const static bool PROCESS_UNCHANGED_PAYLOAD = false;
 };
 
 
@@ -7,11 +7,11 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 #include "../../Helpers/VanCanAirConditionerSpeedMap.h"
 
 #include "../Handlers/AbstractVanMessageHandler.h"
 #include "../Structs/VanAirConditioner1Structs.h"
+#include "../Generated/VanSignals.h"
 
 class VanAirConditioner1Handler : public AbstractVanMessageHandler {
     VanCanAirConditionerSpeedMap* vanCanAirConditionerSpeedMap;
@@ -26,42 +26,41 @@ class VanAirConditioner1Handler : public AbstractVanMessageHandler {
     unsigned long speedQuerySuppresedUntilTime = 0;
     unsigned long currentTime = 0;
 
-    ~VanAirConditioner1Handler()
-    {
-
-    }
-
 public:
-    VanAirConditioner1Handler(VanCanAirConditionerSpeedMap* _vanCanAirConditionerSpeedMap)
+    VanAirConditioner1Handler(VanHandlerContext& context)
     {
-        vanCanAirConditionerSpeedMap = _vanCanAirConditionerSpeedMap;
+        vanCanAirConditionerSpeedMap = &context.AirConditionerSpeedMap;
     }
 
+    const static uint16_t IDENT = VAN_ID_AIR_CONDITIONER_1;
+    const static uint8_t LENGTH = VAN_ID_AIR_CONDITIONER_1_LENGTH;
+    // speed queries are suppressed for a while after a change
+    const static bool PROCESS_UNCHANGED_PAYLOAD = true;
+
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_AIR_CONDITIONER_1) && messageLength == VAN_ID_AIR_CONDITIONER_1_LENGTH))
+        currentTime = millis();
+
+        if (frame.GetLength() < VanAirConditioner1Signals::LENGTH)
         {
             return false;
         }
 
-        currentTime = millis();
+        const uint8_t* payload = frame.GetPayload();
+        const uint8_t fanSpeed = VanAirConditioner1Signals::GetFanSpeed(payload);
 
-        const VanAirConditioner1Packet packet = DeSerialize<VanAirConditioner1Packet>(vanMessageWithoutId);
         if (
-               (vanMessageWithoutId[0] == 0x00 && (packet.data.FanSpeed == 0x00))  // off
-            || (vanMessageWithoutId[0] == 0x00 && (packet.data.FanSpeed == 0x0E))  // off + rear window heating
-            || (vanMessageWithoutId[0] == 0x01 && (packet.data.FanSpeed == 0x0E))  // off + rear window heating toggle
-            || (vanMessageWithoutId[0] == 0x04 && (packet.data.FanSpeed == 0x00))  // off + recycle
-            || (vanMessageWithoutId[0] == 0x04 && (packet.data.FanSpeed == 0x0E))  // off + rear window heating + recycle
-            || (vanMessageWithoutId[0] == 0x05 && (packet.data.FanSpeed == 0x00))  // off + rear window heating + recycle toggle
-            || (vanMessageWithoutId[0] == 0x05 && (packet.data.FanSpeed == 0x0E))  // off + rear window heating + recycle toggle
+               (frame.GetByte(0) == 0x00 && (fanSpeed == 0x00))  // off
+            || (frame.GetByte(0) == 0x00 && (fanSpeed == 0x0E))  // off + rear window heating
+            || (frame.GetByte(0) == 0x01 && (fanSpeed == 0x0E))  // off + rear window heating toggle
+            || (frame.GetByte(0) == 0x04 && (fanSpeed == 0x00))  // off + recycle
+            || (frame.GetByte(0) == 0x04 && (fanSpeed == 0x0E))  // off + rear window heating + recycle
+            || (frame.GetByte(0) == 0x05 && (fanSpeed == 0x00))  // off + rear window heating + recycle toggle
+            || (frame.GetByte(0) == 0x05 && (fanSpeed == 0x0E))  // off + rear window heating + recycle toggle
             )
         {
             dataToBridge->IsHeatingPanelPoweredOn = 0;
@@ -73,8 +72,8 @@ class VanAirConditioner1Handler : public AbstractVanMessageHandler {
         else
         {
             dataToBridge->IsHeatingPanelPoweredOn = 1;
-            dataToBridge->IsAirConEnabled = packet.data.Status.aircon_requested;
-            dataToBridge->IsAirRecyclingOn = packet.data.Status.recycling_on;
+            dataToBridge->IsAirConEnabled = VanAirConditioner1Signals::GetAirConRequested(payload);
+            dataToBridge->IsAirRecyclingOn = VanAirConditioner1Signals::GetRecyclingOn(payload);
 
             const bool isModifierChanged =
                 dataToBridge->IsAirConEnabled != prevACEnabled ||
@@ -86,7 +85,7 @@ class VanAirConditioner1Handler : public AbstractVanMessageHandler {
                 if (currentTime > speedQuerySuppresedUntilTime)
                 {
                     previousFanSpeed = vanCanAirConditionerSpeedMap->GetFanSpeedFromVANByte(
-                        packet.data.FanSpeed,
+                        fanSpeed,
                         dataToBridge->IsAirConEnabled,
                         dataToBridge->IsWindowHeatingOn,
                         dataToBridge->IsAirRecyclingOn);
@@ -9,41 +9,42 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
 #include "../Structs/VanAirConditioner2Structs.h"
+#include "../Generated/VanSignals.h"
 
 class VanAirConditioner2Handler : public AbstractVanMessageHandler {
-    ~VanAirConditioner2Handler()
-    {
+public:
+    const static uint16_t IDENT = VAN_ID_AIR_CONDITIONER_2;
+    const static uint8_t LENGTH = VAN_ID_AIR_CONDITIONER_2_LENGTH;
+    // the result depends on the heating panel state from another frame
+    const static bool PROCESS_UNCHANGED_PAYLOAD = true;
 
+    VanAirConditioner2Handler(VanHandlerContext& context)
+    {
     }
 
-public:
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_AIR_CONDITIONER_2) && messageLength == VAN_ID_AIR_CONDITIONER_2_LENGTH))
+        if (frame.GetLength() < VanAirConditioner2Signals::LENGTH)
         {
             return false;
         }
 
-        const VanAirConditioner2Packet packet = DeSerialize<VanAirConditioner2Packet>(vanMessageWithoutId);
+        const uint8_t* payload = frame.GetPayload();
         if (dataToBridge->IsHeatingPanelPoweredOn == 1)
         {
-            dataToBridge->IsAirConRunning = packet.data.Status1.ac_on && packet.data.Status1.ac_compressor_running;
-            dataToBridge->IsWindowHeatingOn = packet.data.Status1.rear_window_heating_on;
+            dataToBridge->IsAirConRunning = VanAirConditioner2Signals::GetAirConOn(payload) && VanAirConditioner2Signals::GetCompressorRunning(payload);
+            dataToBridge->IsWindowHeatingOn = VanAirConditioner2Signals::GetRearWindowHeatingOn(payload);
         }
 
         if (HW_VERSION == 11 || !QUERY_AC_STATUS)
         {
-            dataToBridge->InternalTemperature = GetEvaporatorTemperature(packet.data.EvaporatorTemperature);
+            dataToBridge->InternalTemperature = VanAirConditioner2Signals::GetEvaporatorTemperature(payload);
         }
 
         return true;
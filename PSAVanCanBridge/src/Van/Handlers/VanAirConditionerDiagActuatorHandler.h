@@ -9,17 +9,11 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
 #include "../Structs/VanAirConditionerDiagStructs.h"
 #include "../../Can/Structs/CanAirConOnDisplayStructs.h"
 
 class VanAirConditionerDiagActuatorHandler : public AbstractVanMessageHandler {
-    ~VanAirConditionerDiagActuatorHandler()
-    {
-
-    }
-
 private:
     uint8_t GetACDirection(uint8_t vanByte)
     {
@@ -48,23 +42,31 @@ class VanAirConditionerDiagActuatorHandler : public AbstractVanMessageHandler {
     }
 
 public:
+    const static uint16_t IDENT = VAN_ID_AIR_CONDITIONER_DIAG;
+    const static uint8_t LENGTH = 12;
+
+    VanAirConditionerDiagActuatorHandler(VanHandlerContext& context)
+    {
+    }
+
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_AIR_CONDITIONER_DIAG) && messageLength == 12 && vanMessageWithoutId[2] == VAN_ID_AIR_CONDITIONER_DIAG_ACTUATOR_STATUS))
+        if (frame.GetByte(2) != VAN_ID_AIR_CONDITIONER_DIAG_ACTUATOR_STATUS)
         {
             return false;
         }
 
-        const VanAirConditionerDiagActuatorStatusPacket packet = DeSerialize<VanAirConditionerDiagActuatorStatusPacket>(vanMessageWithoutId);
+        const VanAirConditionerDiagActuatorStatusPacket* packet = frame.As<VanAirConditionerDiagActuatorStatusPacket>();
+        if (packet == nullptr)
+        {
+            return false;
+        }
 
-        dataToBridge->AirConDirection = GetACDirection(packet.data.DistributionStatus);
+        dataToBridge->AirConDirection = GetACDirection(packet->data.DistributionStatus);
 
         return true;
     }
@@ -9,33 +9,36 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
 #include "../Structs/VanAirConditionerDiagStructs.h"
 
 class VanAirConditionerDiagSensorHandler : public AbstractVanMessageHandler {
-    ~VanAirConditionerDiagSensorHandler()
-    {
+public:
+    const static uint16_t IDENT = VAN_ID_AIR_CONDITIONER_DIAG;
+    const static uint8_t LENGTH = 22;
 
+    VanAirConditionerDiagSensorHandler(VanHandlerContext& context)
+    {
     }
 
-public:
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_AIR_CONDITIONER_DIAG) && messageLength == 22 && vanMessageWithoutId[2] == VAN_ID_AIR_CONDITIONER_DIAG_SENSOR_STATUS))
+        if (frame.GetByte(2) != VAN_ID_AIR_CONDITIONER_DIAG_SENSOR_STATUS)
+        {
+            return false;
+        }
+
+        const VanAirConditionerDiagSensorStatusPacket* packet = frame.As<VanAirConditionerDiagSensorStatusPacket>();
+        if (packet == nullptr)
         {
             return false;
         }
 
-        const VanAirConditionerDiagSensorStatusPacket packet = DeSerialize<VanAirConditionerDiagSensorStatusPacket>(vanMessageWithoutId);
-        ignitionDataToBridge->InternalTemperature = GetACDiagTemperatureFromVanValue(packet.data.InternalTemperature1, packet.data.InternalTemperature2);
+        ignitionDataToBridge->InternalTemperature = GetACDiagTemperatureFromVanValue(packet->data.InternalTemperature1, packet->data.InternalTemperature2);
         dataToBridge->InternalTemperature = ignitionDataToBridge->InternalTemperature;
         return true;
     }
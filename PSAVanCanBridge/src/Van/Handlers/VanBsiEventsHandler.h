@@ -9,54 +9,48 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
 #include "../Structs/VanBsiEventsStructs.h"
-#include "../../Can/Handlers/CanTripInfoHandler.h"
 
 class VanBsiEventsHandler : public AbstractVanMessageHandler {
     const uint16_t chillTime = 1200;
 
-    CanTripInfoHandler* _canTripInfoHandler;
+    BridgeEventQueue* _events;
     uint32_t lastTimeButtonPressed = 0;
 
-    ~VanBsiEventsHandler()
-    {
-
-    }
-
     public:
-    VanBsiEventsHandler(CanTripInfoHandler* canTripInfoHandler)
+    VanBsiEventsHandler(VanHandlerContext& context)
     {
-        _canTripInfoHandler = canTripInfoHandler;
+        _events = context.Events;
     }
 
+    const static uint16_t IDENT = VAN_ID_BSI_EVENTS;
+    const static uint8_t LENGTH = VAN_ID_BSI_EVENTS_LENGTH;
+    // button presses are timed
+    const static bool PROCESS_UNCHANGED_PAYLOAD = true;
+
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_BSI_EVENTS) && messageLength == VAN_ID_BSI_EVENTS_LENGTH))
+        const VanBsiEventsPacket* packet = frame.As<VanBsiEventsPacket>();
+        if (packet == nullptr)
         {
             return false;
         }
 
-        const VanBsiEventsPacket packet = DeSerialize<VanBsiEventsPacket>(vanMessageWithoutId);
-
-        if (packet.data.Ident.event_source == VAN_BSI_EVENT_SOURCE_BSI)
+        if (packet->data.Ident.event_source == VAN_BSI_EVENT_SOURCE_BSI)
         {
-            if (packet.data.Cause.trip_button_pressed == 1)
+            if (packet->data.Cause.trip_button_pressed == 1)
             {
                 // this is wrong as this message is sent periodically, even if the button is not pressed, you should check 0x564 for the trip button press info
                 uint32_t currentTime = millis();
                 if (currentTime - lastTimeButtonPressed > chillTime)
                 {
                     lastTimeButtonPressed = currentTime;
-                    _canTripInfoHandler->TripButtonPress();
+                    _events->Push(BRIDGE_EVENT_TRIP_BUTTON_PRESSED);
                 }
             }
         }
@@ -9,90 +9,93 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
-#include "../../Can/Handlers/ICanDisplayPopupHandler.h"
-#include "../../Can/Handlers/CanTripInfoHandler.h"
+#include "../../Can/Structs/CanDisplayStructs.h"
 #include "../Structs/VanCarStatusWithTripComputerStructs.h"
+#include "../Generated/VanSignals.h"
 
 class VanCarStatusWithTripComputerHandler : public AbstractVanMessageHandler {
-    ICanDisplayPopupHandler* canPopupHandler;
-    CanTripInfoHandler* canTripInfoHandler;
+    // the door popup is queued at once when a door changes, otherwise repeated in this interval
+    const static uint16_t DOOR_POPUP_REFRESH_INTERVAL = 1000;
 
-    uint8_t previousTripButtonState = 0;
-
-    ~VanCarStatusWithTripComputerHandler()
-    {
+    BridgeEventQueue* _events;
 
-    }
+    uint8_t previousTripButtonState = 0;
+    uint8_t previousDoorStatus = 0;
+    unsigned long previousDoorPopupTime = 0;
 
 public:
-    VanCarStatusWithTripComputerHandler(ICanDisplayPopupHandler* _canPopupHandler, CanTripInfoHandler* _canTripInfoHandler)
+    VanCarStatusWithTripComputerHandler(VanHandlerContext& context)
     {
-        canPopupHandler = _canPopupHandler;
-        canTripInfoHandler = _canTripInfoHandler;
+        _events = context.Events;
     }
 
+    const static uint16_t IDENT = VAN_ID_CARSTATUS;
+    const static uint8_t LENGTH = VanCarStatusSignals::LENGTH;
+    // the door popup is repeated even if the frame doesn't change
+    const static bool PROCESS_UNCHANGED_PAYLOAD = true;
+
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_CARSTATUS) && messageLength == 27))
+        if (frame.GetLength() < VanCarStatusSignals::LENGTH)
         {
             return false;
         }
 
-        const VanCarStatusWithTripComputerPacket packet = DeSerialize<VanCarStatusWithTripComputerPacket>(vanMessageWithoutId);
-
-        dataToBridge->Trip1Consumption = SwapHiByteAndLoByte(packet.data.Trip1FuelConsumption.data);
-        dataToBridge->Trip1Distance = SwapHiByteAndLoByte(packet.data.Trip1Distance.data);
-        dataToBridge->Trip1Speed = packet.data.Trip1Speed;
+        const uint8_t* payload = frame.GetPayload();
 
-        dataToBridge->Trip2Consumption = SwapHiByteAndLoByte(packet.data.Trip2FuelConsumption.data);
-        dataToBridge->Trip2Distance = SwapHiByteAndLoByte(packet.data.Trip2Distance.data);
-        dataToBridge->Trip2Speed = packet.data.Trip2Speed;
+        dataToBridge->Trip1Consumption = VanCarStatusSignals::GetTrip1FuelConsumption(payload);
+        dataToBridge->Trip1Distance = VanCarStatusSignals::GetTrip1Distance(payload);
+        dataToBridge->Trip1Speed = VanCarStatusSignals::GetTrip1Speed(payload);
 
-        dataToBridge->FuelConsumption = SwapHiByteAndLoByte(packet.data.FuelConsumption.data);
-        dataToBridge->FuelLeftToPump = SwapHiByteAndLoByte(packet.data.FuelLeftToPumpInKm.data);
+        dataToBridge->Trip2Consumption = VanCarStatusSignals::GetTrip2FuelConsumption(payload);
+        dataToBridge->Trip2Distance = VanCarStatusSignals::GetTrip2Distance(payload);
+        dataToBridge->Trip2Speed = VanCarStatusSignals::GetTrip2Speed(payload);
 
-        ignitionDataToBridge->TripButtonPressed = packet.data.Field10.TripButton;
+        dataToBridge->FuelConsumption = VanCarStatusSignals::GetFuelConsumption(payload);
+        dataToBridge->FuelLeftToPump = VanCarStatusSignals::GetFuelLeftToPumpInKm(payload);
 
+        const uint8_t tripButton = VanCarStatusSignals::GetTripButton(payload);
+        ignitionDataToBridge->TripButtonPressed = tripButton;
 
-        if (previousTripButtonState != packet.data.Field10.TripButton)
+        if (previousTripButtonState != tripButton)
         {
-            previousTripButtonState = packet.data.Field10.TripButton;
+            previousTripButtonState = tripButton;
             if (previousTripButtonState == 0)
             {
-                canTripInfoHandler->TripButtonPress();
+                _events->Push(BRIDGE_EVENT_TRIP_BUTTON_PRESSED);
             }
         }
 
-        doorStatus.status.FrontLeft = packet.data.Doors.FrontLeft;
-        doorStatus.status.FrontRight = packet.data.Doors.FrontRight;
-        doorStatus.status.RearLeft = packet.data.Doors.RearLeft;
-        doorStatus.status.RearRight = packet.data.Doors.RearRight;
-        doorStatus.status.BootLid = packet.data.Doors.BootLid;
-        doorStatus.status.Hood = packet.data.Doors.Hood;
-        doorStatus.status.Sunroof = packet.data.Doors.Sunroof;
-        doorStatus.status.FuelFlap = packet.data.Doors.FuelFlap;
-
-        CanDisplayPopupItem item;
-        item.Category = CAN_POPUP_MSG_SHOW_CATEGORY1;
-        item.MessageType = CAN_POPUP_MSG_DOORS_BOOT_BONNET_REAR_SCREEN_AND_FUEL_TANK_OPEN;
-        item.DoorStatus1 = doorStatus.asByte;
-        item.DoorStatus2 = 0;
-        item.KmToDisplay = 0;
-        item.IsInited = false;
-        item.Counter = 0;
-        item.Visible = false;
-        item.SetVisibleOnDisplayTime = 0;
-        item.VANByte = 0x02;
-        canPopupHandler->QueueNewMessage(item);
+        doorStatus.status.FrontLeft = VanCarStatusSignals::GetFrontLeftDoorOpen(payload);
+        doorStatus.status.FrontRight = VanCarStatusSignals::GetFrontRightDoorOpen(payload);
+        doorStatus.status.RearLeft = VanCarStatusSignals::GetRearLeftDoorOpen(payload);
+        doorStatus.status.RearRight = VanCarStatusSignals::GetRearRightDoorOpen(payload);
+        doorStatus.status.BootLid = VanCarStatusSignals::GetBootLidOpen(payload);
+        doorStatus.status.Hood = VanCarStatusSignals::GetHoodOpen(payload);
+        doorStatus.status.Sunroof = VanCarStatusSignals::GetSunroofOpen(payload);
+        doorStatus.status.FuelFlap = VanCarStatusSignals::GetFuelFlapOpen(payload);
+
+        const unsigned long currentTime = millis();
+        if (doorStatus.asByte == previousDoorStatus && currentTime - previousDoorPopupTime < DOOR_POPUP_REFRESH_INTERVAL)
+        {
+            return true;
+        }
+        previousDoorStatus = doorStatus.asByte;
+        previousDoorPopupTime = currentTime;
+
+        BridgeEvent event;
+        event.Type = BRIDGE_EVENT_POPUP_RAISED;
+        event.Popup.Category = CAN_POPUP_MSG_SHOW_CATEGORY1;
+        event.Popup.MessageType = CAN_POPUP_MSG_DOORS_BOOT_BONNET_REAR_SCREEN_AND_FUEL_TANK_OPEN;
+        event.Popup.DoorStatus1 = doorStatus.asByte;
+        event.Popup.DoorStatus2 = 0;
+        event.Popup.VANByte = 0x02;
+        _events->Push(event);
 
         return true;
     }
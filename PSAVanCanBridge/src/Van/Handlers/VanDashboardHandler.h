@@ -9,46 +9,48 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
 #include "../Structs/VanDashboardStructs.h"
+#include "../Generated/VanSignals.h"
 
 class VanDashboardHandler : public AbstractVanMessageHandler {
-    ~VanDashboardHandler()
-    {
+public:
+    const static uint16_t IDENT = VAN_ID_DASHBOARD;
+    const static uint8_t LENGTH = 7;
 
+    VanDashboardHandler(VanHandlerContext& context)
+    {
     }
 
-public:
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_DASHBOARD) && messageLength == 7))
+        if (frame.GetLength() < VanDashboardSignals::LENGTH)
         {
             return false;
         }
 
-        const VanDashboardPacket packet = DeSerialize<VanDashboardPacket>(vanMessageWithoutId);
-        ignitionDataToBridge->WaterTemperature = GetWaterTemperatureFromVANByte(packet.data.WaterTemperature.value);
-        ignitionDataToBridge->OutsideTemperature = GetTemperatureFromVANByte(packet.data.ExternalTemperature.value);
-        ignitionDataToBridge->EconomyModeActive = packet.data.Field1.economy_mode;
-        ignitionDataToBridge->Ignition = packet.data.Field1.ignition_on || packet.data.Field1.accesories_on || packet.data.Field1.engine_running;
-        ignitionDataToBridge->DashboardLightingEnabled = packet.data.Field0.is_backlight_off == 0;
+        const uint8_t* payload = frame.GetPayload();
+
+        ignitionDataToBridge->WaterTemperature = VanDashboardSignals::GetWaterTemperature(payload);
+        ignitionDataToBridge->OutsideTemperature = VanDashboardSignals::GetExternalTemperature(payload);
+        ignitionDataToBridge->EconomyModeActive = VanDashboardSignals::GetEconomyMode(payload);
+        ignitionDataToBridge->Ignition = VanDashboardSignals::GetIgnitionOn(payload) || VanDashboardSignals::GetAccessoriesOn(payload) || VanDashboardSignals::GetEngineRunning(payload);
+        ignitionDataToBridge->DashboardLightingEnabled = VanDashboardSignals::GetIsBacklightOff(payload) == 0;
 
-        dataToBridge->LightStatuses.status.SideLights = packet.data.Field0.is_backlight_off == 0;
+        dataToBridge->LightStatuses.status.SideLights = VanDashboardSignals::GetIsBacklightOff(payload) == 0;
         dataToBridge->Ignition = ignitionDataToBridge->Ignition;
 
-        ignitionDataToBridge->IsTrailerPresent = packet.data.Field1.trailer_present;
-        ignitionDataToBridge->IsReverseEngaged = packet.data.Field1.reverse_gear;
-        ignitionDataToBridge->MileageByte1 = packet.data.MileageByte1;
-        ignitionDataToBridge->MileageByte2 = packet.data.MileageByte2;
-        ignitionDataToBridge->MileageByte3 = packet.data.MileageByte3;
+        ignitionDataToBridge->IsTrailerPresent = VanDashboardSignals::GetTrailerPresent(payload);
+        ignitionDataToBridge->IsReverseEngaged = VanDashboardSignals::GetReverseGear(payload);
+
+        const uint32_t mileage = VanDashboardSignals::GetMileage(payload);
+        ignitionDataToBridge->MileageByte1 = mileage >> 16;
+        ignitionDataToBridge->MileageByte2 = mileage >> 8;
+        ignitionDataToBridge->MileageByte3 = mileage;
 
         return true;
     }
@@ -11,39 +11,29 @@
 #include "../../Helpers/DoorStatus.h"
 
 #include "../Structs/VanDisplayStructsV1.h"
+#include "VanDisplayHandlerV2.h"
 
-class VanDisplayHandlerV1 : public AbstractVanMessageHandler {
-    AbstractVanMessageHandler* _vanDisplayHandlerV2;
-
-    ~VanDisplayHandlerV1()
-    {
-
-    }
-
+/* The V1 frame is a shorter V2 frame, it is padded and processed as V2 */
+class VanDisplayHandlerV1 : public VanDisplayHandlerV2 {
 public:
-    VanDisplayHandlerV1(AbstractVanMessageHandler* vanDisplayHandlerV2)
+    VanDisplayHandlerV1(VanHandlerContext& context) : VanDisplayHandlerV2(context)
     {
-        _vanDisplayHandlerV2 = vanDisplayHandlerV2;
     }
 
+    const static uint16_t IDENT = VAN_ID_DISPLAY_POPUP_V1;
+    const static uint8_t LENGTH = 14;
+
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_DISPLAY_POPUP_V1) && messageLength == 14))
-        {
-            return false;
-        }
-
         uint8_t vanMessageV2[16] = { 0x00 };
-        memcpy(vanMessageV2, vanMessageWithoutId, 14);
+        memcpy(vanMessageV2, frame.GetPayload(), 14);
 
-        return _vanDisplayHandlerV2->ProcessMessage(identByte1, identByte2, vanMessageV2, 16, dataToBridge, ignitionDataToBridge, doorStatus);
+        const VanFrameView frameV2(vanMessageV2, 16, frame.GetIdent(), frame.GetTimestamp());
+        return VanDisplayHandlerV2::ProcessMessage(frameV2, dataToBridge, ignitionDataToBridge, doorStatus);
     }
 };
 
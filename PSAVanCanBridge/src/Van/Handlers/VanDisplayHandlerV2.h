@@ -10,78 +10,129 @@
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
 #include "../../Helpers/VanCanDisplayPopupMap.h"
-#include "../../Helpers/Serializer.h"
 
-#include "../../Can/Handlers/CanTripInfoHandler.h"
-#include "../../Can/Handlers/ICanDisplayPopupHandler.h"
-#include "../../Can/Handlers/CanStatusOfFunctionsHandler.h"
-#include "../../Can/Handlers/CanWarningLogHandler.h"
+#include "../../Can/Structs/CanDisplayStructs.h"
 #include "../Structs/VanDisplayStructsV2.h"
 
 class VanDisplayHandlerV2 : public AbstractVanMessageHandler {
-    ICanDisplayPopupHandler* canPopupHandler;
-    CanTripInfoHandler* canTripInfoHandler;
-    CanStatusOfFunctionsHandler* canStatusOfFunctionsHandler;
-    CanWarningLogHandler* canWarningLogHandler;
-    VanCanDisplayPopupMap* popupMapping;
+    // the events are pushed at once when a value changes, otherwise repeated in this interval (the CAN side forgets
+    // the status of functions and the warnings when the ignition is switched off)
+    const static uint16_t EVENT_REFRESH_INTERVAL = 1000;
+
+    // the status of functions and warnings sent as events, one bit each
+    const static uint8_t STATUS_PASSENGER_AIRBAG_DISABLED = 0x01;
+    const static uint8_t STATUS_AUTOMATIC_HEADLAMP_ENABLED = 0x02;
+    const static uint8_t STATUS_AUTOMATIC_DOOR_LOCKING_ENABLED = 0x04;
+    const static uint8_t STATUS_GEARBOX_FAULT = 0x08;
+    const static uint8_t STATUS_ENGINE_FAULT_REPAIR_NEEDED = 0x10;
+
+    BridgeEventQueue* _events;
+    const SignalBus* _signals;
 
     const uint16_t LEFT_STICK_BUTTON_TIME = 5000;
     unsigned long leftStickButtonReturn = 0;
     unsigned long currentTime = 0;
 
-    ~VanDisplayHandlerV2()
+    unsigned long previousRefreshTime = 0;
+    uint8_t previousMessage = VAN_POPUP_MSG_NONE;
+    uint8_t previousStatus = 0;
+    bool previousSeatBeltPopup = false;
+
+    uint8_t GetStatus(const VanDisplayPacketV2* packet)
     {
+        uint8_t status = 0;
+        if (packet->data.Field5.passenger_airbag_deactivated || packet->data.Field8.child_safety_activated)
+        {
+            status |= STATUS_PASSENGER_AIRBAG_DISABLED;
+        }
+        if (packet->data.Field8.automatic_lighting_active)
+        {
+            status |= STATUS_AUTOMATIC_HEADLAMP_ENABLED;
+        }
+        if (packet->data.Field8.deadlocking_active)
+        {
+            status |= STATUS_AUTOMATIC_DOOR_LOCKING_ENABLED;
+        }
+        if (packet->data.Field2.automatic_gearbox_faulty)
+        {
+            status |= STATUS_GEARBOX_FAULT;
+        }
+        if (packet->data.Field4.catalytic_converter_fault || packet->data.Field2.mil)
+        {
+            status |= STATUS_ENGINE_FAULT_REPAIR_NEEDED;
+        }
+        return status;
+    }
 
+    void PushStatus(uint8_t status)
+    {
+        if (status & STATUS_PASSENGER_AIRBAG_DISABLED)
+        {
+            _events->Push(BRIDGE_EVENT_PASSENGER_AIRBAG_DISABLED);
+        }
+        _events->Push(status & STATUS_AUTOMATIC_HEADLAMP_ENABLED ? BRIDGE_EVENT_AUTOMATIC_HEADLAMP_ENABLED : BRIDGE_EVENT_AUTOMATIC_HEADLAMP_DISABLED);
+        if (status & STATUS_AUTOMATIC_DOOR_LOCKING_ENABLED)
+        {
+            _events->Push(BRIDGE_EVENT_AUTOMATIC_DOOR_LOCKING_ENABLED);
+        }
+        if (status & STATUS_GEARBOX_FAULT)
+        {
+            _events->Push(BRIDGE_EVENT_GEARBOX_FAULT);
+        }
+        if (status & STATUS_ENGINE_FAULT_REPAIR_NEEDED)
+        {
+            _events->Push(BRIDGE_EVENT_ENGINE_FAULT_REPAIR_NEEDED);
+        }
     }
 
 public:
-    VanDisplayHandlerV2(
-        ICanDisplayPopupHandler* _canPopupHandler, 
-        CanTripInfoHandler* _canTripInfoHandler, 
-        VanCanDisplayPopupMap* _popupMapping,
-        CanStatusOfFunctionsHandler* _canStatusOfFunctionsHandler,
-        CanWarningLogHandler* _canWarningLogHandler
-        )
+    VanDisplayHandlerV2(VanHandlerContext& context)
     {
-        canPopupHandler = _canPopupHandler;
-        canTripInfoHandler = _canTripInfoHandler;
-        popupMapping = _popupMapping;
-        canStatusOfFunctionsHandler = _canStatusOfFunctionsHandler;
-        canWarningLogHandler = _canWarningLogHandler;
+        _events = context.Events;
+        _signals = context.Signals;
     }
 
+    const static uint16_t IDENT = VAN_ID_DISPLAY_POPUP_V2;
+    const static uint8_t LENGTH = 16;
+    // the popups and the status are refreshed even if the frame doesn't change
+    const static bool PROCESS_UNCHANGED_PAYLOAD = true;
+
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_DISPLAY_POPUP_V2) && messageLength == 16))
+        currentTime = millis();
+
+        const VanDisplayPacketV2* packet = frame.As<VanDisplayPacketV2>();
+        if (packet == nullptr)
         {
             return false;
         }
 
-        currentTime = millis();
+        const bool refresh = currentTime - previousRefreshTime >= EVENT_REFRESH_INTERVAL;
+        if (refresh)
+        {
+            previousRefreshTime = currentTime;
+        }
+
+        const bool hasPopup = packet->data.Message != VAN_POPUP_MSG_NONE && packet->data.Message != VAN_POPUP_MSG_DOOR_OPEN;
+        const bool popupChanged = packet->data.Message != previousMessage;
+        previousMessage = packet->data.Message;
 
-        const VanDisplayPacketV2 packet = DeSerialize<VanDisplayPacketV2>(vanMessageWithoutId);
-        if (packet.data.Message != VAN_POPUP_MSG_NONE && packet.data.Message != VAN_POPUP_MSG_DOOR_OPEN)
+        if (hasPopup && (popupChanged || refresh))
         {
-            CanDisplayPopupItem item;
-            item.Category = popupMapping->GetCanCategoryFromVanMessage(packet.data.Message);
-            item.MessageType = popupMapping->GetCanMessageIdFromVanMessage(packet.data.Message);
+            BridgeEvent event;
+            event.Type = BRIDGE_EVENT_POPUP_RAISED;
+            BridgeEventPopup& item = event.Popup;
+            item.Category = VanCanDisplayPopupMap::GetCanCategoryFromVanMessage(packet->data.Message);
+            item.MessageType = VanCanDisplayPopupMap::GetCanMessageIdFromVanMessage(packet->data.Message);
             item.DoorStatus1 = 0;
             item.DoorStatus2 = 0;
-            item.KmToDisplay = 0;
-            item.IsInited = false;
-            item.Counter = 0;
-            item.Visible = false;
-            item.SetVisibleOnDisplayTime = 0;
-            item.VANByte = packet.data.Message;
-
-            switch (packet.data.Message)
+            item.VANByte = packet->data.Message;
+
+            switch (packet->data.Message)
             {
                 case VAN_POPUP_MSG_FUEL_TANK_ACCESS_OPEN:
                 {
@@ -121,75 +172,53 @@ class VanDisplayHandlerV2 : public AbstractVanMessageHandler {
                 default:
                     break;
             }
-            if (packet.data.Field5.passenger_airbag_deactivated)
-            {
-                canStatusOfFunctionsHandler->SetPassengerAirbagDisabled();
-            }
-            if (packet.data.Field8.automatic_lighting_active)
-            {
-                canStatusOfFunctionsHandler->SetAutomaticHeadlampEnabled();
-            }
-            else
-            {
-                canStatusOfFunctionsHandler->SetAutomaticHeadlampDisabled();
-            }
-            if (packet.data.Field8.child_safety_activated)
-            {
-                canStatusOfFunctionsHandler->SetPassengerAirbagDisabled();
-            }
-            if (packet.data.Field8.deadlocking_active)
-            {
-                canStatusOfFunctionsHandler->SetAutomaticDoorLockingEnabled();
-            }
-            if (packet.data.Field2.automatic_gearbox_faulty)
-            {
-                canWarningLogHandler->SetGearBoxFault();
-            }
-            if (packet.data.Field4.catalytic_converter_fault || packet.data.Field2.mil)
-            {
-                canWarningLogHandler->SetEngineFaultRepairNeeded();
-            }
 
-            canPopupHandler->QueueNewMessage(item);
+            _events->Push(event);
         }
 
-        dataToBridge->DashIcons1Field.status.SeatBeltWarning = packet.data.Field5.seatbelt_warning;
-        dataToBridge->DashIcons1Field.status.FuelLowLight = packet.data.Field6.fuel_level_low;
-        dataToBridge->DashIcons1Field.status.PassengerAirbag = packet.data.Field5.passenger_airbag_deactivated;
-        dataToBridge->DashIcons1Field.status.Handbrake = packet.data.Field5.handbrake;
-        dataToBridge->DashIcons1Field.status.Abs = packet.data.Field2.abs;
-        dataToBridge->DashIcons1Field.status.Esp = packet.data.Field2.esp;
-        dataToBridge->DashIcons1Field.status.Mil = packet.data.Field2.mil;
-        dataToBridge->DashIcons1Field.status.Airbag = packet.data.Field3.side_airbag_faulty;
+        // the status is only read while a popup is shown
+        if (hasPopup)
+        {
+            const uint8_t status = GetStatus(packet);
+            if (status != previousStatus || refresh)
+            {
+                previousStatus = status;
+                PushStatus(status);
+            }
+        }
 
-        if (packet.data.Field5.seatbelt_warning)
+        dataToBridge->DashIcons1Field.status.SeatBeltWarning = packet->data.Field5.seatbelt_warning;
+        dataToBridge->DashIcons1Field.status.FuelLowLight = packet->data.Field6.fuel_level_low;
+        dataToBridge->DashIcons1Field.status.PassengerAirbag = packet->data.Field5.passenger_airbag_deactivated;
+        dataToBridge->DashIcons1Field.status.Handbrake = packet->data.Field5.handbrake;
+        dataToBridge->DashIcons1Field.status.Abs = packet->data.Field2.abs;
+        dataToBridge->DashIcons1Field.status.Esp = packet->data.Field2.esp;
+        dataToBridge->DashIcons1Field.status.Mil = packet->data.Field2.mil;
+        dataToBridge->DashIcons1Field.status.Airbag = packet->data.Field3.side_airbag_faulty;
+
+        SignalSample speed;
+        const bool seatBeltPopup = packet->data.Field5.seatbelt_warning && _signals->Read(SIGNAL_SPEED, speed) && speed.Value > 10;
+        if (seatBeltPopup != previousSeatBeltPopup || refresh)
         {
-            if (dataToBridge->Speed > 10)
+            previousSeatBeltPopup = seatBeltPopup;
+            if (seatBeltPopup)
             {
-                CanDisplayPopupItem item;
-                item.Category = CAN_POPUP_MSG_SHOW_CATEGORY1;
-                item.MessageType = CAN_POPUP_MSG_FRONT_SEAT_BELTS_NOT_FASTENED;
-                item.DoorStatus1 = CAN_POPUP_SEAT_BELTS_OF_DRIVER;
-                item.DoorStatus2 = 0;
-                item.KmToDisplay = 0;
-                item.IsInited = false;
-                item.Counter = 0;
-                item.Visible = false;
-                item.SetVisibleOnDisplayTime = 0;
-                item.VANByte = 0;
-                canPopupHandler->QueueNewMessage(item);
+                BridgeEvent event;
+                event.Type = BRIDGE_EVENT_POPUP_RAISED;
+                event.Popup.Category = CAN_POPUP_MSG_SHOW_CATEGORY1;
+                event.Popup.MessageType = CAN_POPUP_MSG_FRONT_SEAT_BELTS_NOT_FASTENED;
+                event.Popup.DoorStatus1 = CAN_POPUP_SEAT_BELTS_OF_DRIVER;
+                event.Popup.DoorStatus2 = 0;
+                event.Popup.VANByte = 0;
+                _events->Push(event);
             }
             else
             {
-                canPopupHandler->ResetSeatBeltWarning();
+                _events->Push(BRIDGE_EVENT_SEAT_BELT_WARNING_RESET);
             }
         }
-        else
-        {
-            canPopupHandler->ResetSeatBeltWarning();
-        }
 
-        if (packet.data.Field6.left_stick_button)
+        if (packet->data.Field6.left_stick_button)
         {
             leftStickButtonReturn = currentTime + LEFT_STICK_BUTTON_TIME;
             ignitionDataToBridge->LeftStickButtonPressed = 1;
@@ -9,44 +9,38 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
 #include "../Structs/VanDisplayStatusStructs.h"
-#include "../../Can/Handlers/CanTripInfoHandler.h"
 
 class VanEmfBsiRequestHandler : public AbstractVanMessageHandler {
-    CanTripInfoHandler* _canTripInfoHandler;
-
-    ~VanEmfBsiRequestHandler()
-    {
-
-    }
+    BridgeEventQueue* _events;
 
     public:
-    VanEmfBsiRequestHandler(CanTripInfoHandler* canTripInfoHandler)
+    VanEmfBsiRequestHandler(VanHandlerContext& context)
     {
-        _canTripInfoHandler = canTripInfoHandler;
+        _events = context.Events;
     }
 
+    const static uint16_t IDENT = VAN_ID_DISPLAY_STATUS;
+    const static uint8_t LENGTH = VAN_ID_EMF_BSI_REQUEST_LENGTH;
+    // the reset request is forwarded with every frame
+    const static bool PROCESS_UNCHANGED_PAYLOAD = true;
+
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_DISPLAY_STATUS) && messageLength == VAN_ID_EMF_BSI_REQUEST_LENGTH))
+        const VanDisplayStatusPacket* packet = frame.As<VanDisplayStatusPacket>();
+        if (packet == nullptr)
         {
             return false;
         }
 
-        const VanDisplayStatusPacket packet = DeSerialize<VanDisplayStatusPacket>(vanMessageWithoutId);
-
-        if (packet.data.Requests.request_to_reset_course_totals)
+        if (packet->data.Requests.request_to_reset_course_totals)
         {
-            _canTripInfoHandler->TripResetHappened();
+            _events->Push(BRIDGE_EVENT_TRIP_RESET);
         }
 
         return true;
@@ -0,0 +1,29 @@
+// VanHandlerContext.h
+#pragma once
+
+#ifndef _VanHandlerContext_h
+    #define _VanHandlerContext_h
+
+#include "../../Helpers/VanCanAirConditionerSpeedMap.h"
+#include "../../Helpers/SignalBus.h"
+#include "../../Helpers/BridgeEventQueue.h"
+
+/* Everything the VAN message handlers depend on, every handler is constructed from it */
+struct VanHandlerContext {
+    // the handlers never call the CAN handlers, they push events which the CAN data task applies
+    BridgeEventQueue* Events;
+    SignalBus* Signals;
+
+    VanCanAirConditionerSpeedMap AirConditionerSpeedMap;
+
+    VanHandlerContext(
+        BridgeEventQueue* eventQueue,
+        SignalBus* signalBus
+    )
+    {
+        Events = eventQueue;
+        Signals = signalBus;
+    }
+};
+
+#endif
@@ -11,39 +11,29 @@
 #include "../../Helpers/DoorStatus.h"
 
 #include "../Structs/VanInstrumentClusterV1Structs.h"
+#include "VanInstrumentClusterHandlerV2.h"
 
-class VanInstrumentClusterHandlerV1 : public AbstractVanMessageHandler {
-    AbstractVanMessageHandler* vanInstrumentClusterHandlerV2;
-
-    ~VanInstrumentClusterHandlerV1()
-    {
-
-    }
-
+/* The V1 frame is a shorter V2 frame, it is padded and processed as V2 */
+class VanInstrumentClusterHandlerV1 : public VanInstrumentClusterHandlerV2 {
 public:
-    VanInstrumentClusterHandlerV1(AbstractVanMessageHandler* _vanInstrumentClusterHandlerV2)
+    VanInstrumentClusterHandlerV1(VanHandlerContext& context) : VanInstrumentClusterHandlerV2(context)
     {
-        vanInstrumentClusterHandlerV2 = _vanInstrumentClusterHandlerV2;
     }
 
+    const static uint16_t IDENT = VAN_ID_INSTRUMENT_CLUSTER_V1;
+    const static uint8_t LENGTH = 11;
+
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_INSTRUMENT_CLUSTER_V1) && messageLength == 11))
-        {
-            return false;
-        }
-
         uint8_t vanMessageV2[14] = { 0x00 };
-        memcpy(vanMessageV2, vanMessageWithoutId, 11);
+        memcpy(vanMessageV2, frame.GetPayload(), 11);
 
-        return vanInstrumentClusterHandlerV2->ProcessMessage(identByte1, identByte2, vanMessageV2, 14, dataToBridge, ignitionDataToBridge, doorStatus);
+        const VanFrameView frameV2(vanMessageV2, 14, frame.GetIdent(), frame.GetTimestamp());
+        return VanInstrumentClusterHandlerV2::ProcessMessage(frameV2, dataToBridge, ignitionDataToBridge, doorStatus);
     }
 };
 
@@ -9,56 +9,46 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
 #include "../Structs/VanParkingAidDiagStructs.h"
+#include "../Generated/VanSignals.h"
 
 class VanParkingAidDiagDistanceHandler : public AbstractVanMessageHandler {
-    static const uint16_t VAN_PARKING_AID_DATA_TIMEOUT = 3000;
-    unsigned long _lastTimeDataArrived = 0;
+    SignalBus* _signals;
 
-    ~VanParkingAidDiagDistanceHandler()
-    {
+public:
+    const static uint16_t IDENT = VAN_ID_PARKING_AID_DIAG_ANSWER;
+    const static uint8_t LENGTH = VanParkingAidDiagDistanceSignals::LENGTH;
+    // the timestamps of the distances tell the CAN side whether the parking aid still answers, so they are refreshed even if the distances stay the same
+    const static bool PROCESS_UNCHANGED_PAYLOAD = true;
 
+    VanParkingAidDiagDistanceHandler(VanHandlerContext& context)
+    {
+        _signals = context.Signals;
     }
 
-public:
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        const unsigned long currentTime = millis();
-
-        if (currentTime - _lastTimeDataArrived > VAN_PARKING_AID_DATA_TIMEOUT)
+        if (frame.GetLength() < VanParkingAidDiagDistanceSignals::LENGTH)
         {
-            ignitionDataToBridge->ExteriorRearLeftDistanceInCm = 0xFF;
-            ignitionDataToBridge->ExteriorRearRightDistanceInCm = 0xFF;
-
-            ignitionDataToBridge->InteriorRearLeftDistanceInCm = 0xFF;
-            ignitionDataToBridge->InteriorRearRightDistanceInCm = 0xFF;
-            ignitionDataToBridge->HaveDataFromParkingAid = 0;
+            return false;
         }
 
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_PARKING_AID_DIAG_ANSWER) && messageLength == 24 && vanMessageWithoutId[2] == PR_DIAG_ANSWER_DISTANCE))
+        const uint8_t* payload = frame.GetPayload();
+        if (VanParkingAidDiagDistanceSignals::GetDiagFunctionId(payload) != PR_DIAG_ANSWER_DISTANCE)
         {
             return false;
         }
 
-        _lastTimeDataArrived = currentTime;
-
-        const VanParkingAidDiagDistancePacket packet = DeSerialize<VanParkingAidDiagDistancePacket>(vanMessageWithoutId);
-
-        ignitionDataToBridge->ExteriorRearLeftDistanceInCm = packet.data.ExteriorRearLeftDistanceInCm;
-        ignitionDataToBridge->ExteriorRearRightDistanceInCm = packet.data.ExteriorRearRightDistanceInCm;
-
-        ignitionDataToBridge->InteriorRearLeftDistanceInCm = packet.data.InteriorRearLeftDistanceInCm;
-        ignitionDataToBridge->InteriorRearRightDistanceInCm = packet.data.InteriorRearRightDistanceInCm;
-        ignitionDataToBridge->HaveDataFromParkingAid = 1;
+        const unsigned long currentTime = millis();
+        _signals->Publish(SIGNAL_PARKING_AID_EXTERIOR_REAR_LEFT_DISTANCE, VanParkingAidDiagDistanceSignals::GetExteriorRearLeftDistanceInCm(payload), currentTime);
+        _signals->Publish(SIGNAL_PARKING_AID_EXTERIOR_REAR_RIGHT_DISTANCE, VanParkingAidDiagDistanceSignals::GetExteriorRearRightDistanceInCm(payload), currentTime);
+        _signals->Publish(SIGNAL_PARKING_AID_INTERIOR_REAR_LEFT_DISTANCE, VanParkingAidDiagDistanceSignals::GetInteriorRearLeftDistanceInCm(payload), currentTime);
+        _signals->Publish(SIGNAL_PARKING_AID_INTERIOR_REAR_RIGHT_DISTANCE, VanParkingAidDiagDistanceSignals::GetInteriorRearRightDistanceInCm(payload), currentTime);
 
         return true;
     }
@@ -9,35 +9,37 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
 #include "../Structs/VanParkingAidDiagStructs.h"
 
 class VanParkingAidDiagInputStateHandler : public AbstractVanMessageHandler {
-    ~VanParkingAidDiagInputStateHandler()
-    {
+public:
+    const static uint16_t IDENT = VAN_ID_PARKING_AID_DIAG_ANSWER;
+    const static uint8_t LENGTH = 5;
 
+    VanParkingAidDiagInputStateHandler(VanHandlerContext& context)
+    {
     }
 
-public:
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_PARKING_AID_DIAG_ANSWER) && messageLength == 5 && vanMessageWithoutId[2] == PR_DIAG_ANSWER_STATE_OF_INPUT))
+        if (frame.GetByte(2) != PR_DIAG_ANSWER_STATE_OF_INPUT)
         {
             return false;
         }
 
-        const VanParkingAidInputStatePacket packet = DeSerialize<VanParkingAidInputStatePacket>(vanMessageWithoutId);
+        const VanParkingAidInputStatePacket* packet = frame.As<VanParkingAidInputStatePacket>();
+        if (packet == nullptr)
+        {
+            return false;
+        }
 
-        ignitionDataToBridge->IsReverseEngaged = packet.data.Status.system_active;
-        ignitionDataToBridge->IsTrailerPresent = packet.data.Status.trailer_present;
+        ignitionDataToBridge->IsReverseEngaged = packet->data.Status.system_active;
+        ignitionDataToBridge->IsTrailerPresent = packet->data.Status.trailer_present;
 
         return true;
     }
@@ -11,30 +11,23 @@
 #include "../../Helpers/DoorStatus.h"
 
 #include "../Structs/VanPositionForRt3Structs.h"
-#include "../../Helpers/Serializer.h"
 
 class VanPositionForRt3Handler : public AbstractVanMessageHandler {
-    ~VanPositionForRt3Handler()
-    {
+public:
+    const static uint16_t IDENT = VAN_ID_POSITION_FOR_RT3;
+    const static uint8_t LENGTH = VAN_ID_POSITION_FOR_RT3_LENGTH;
 
+    VanPositionForRt3Handler(VanHandlerContext& context)
+    {
     }
 
-public:
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_POSITION_FOR_RT3) && messageLength == VAN_ID_POSITION_FOR_RT3_LENGTH))
-        {
-            return false;
-        }
-
-        const VanPositionForRt3Packet packet = DeSerialize<VanPositionForRt3Packet>(vanMessageWithoutId);
+        const VanPositionForRt3Packet packet = frame.ReadPacket<VanPositionForRt3Packet>();
         dataToBridge->RightWheelPosition = packet.data.RearRightAbsStatus.asRawValue;
         dataToBridge->LeftWheelPosition = packet.data.RearLeftAbsStatus.asRawValue;
 
@@ -9,51 +9,47 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
-#include "../../Can/Handlers/CanTripInfoHandler.h"
-#include "../../Can/Handlers/CanRadioRemoteMessageHandler.h"
 #include "../Structs/VanRadioRemoteStructs.h"
 
 class VanRadioRemoteHandler : public AbstractVanMessageHandler {
-    CanTripInfoHandler* canTripInfoHandler;
-    CanRadioRemoteMessageHandler* canRadioRemoteMessageHandler;
-
-    ~VanRadioRemoteHandler()
-    {
-
-    }
+    BridgeEventQueue* _events;
 
 public:
-    VanRadioRemoteHandler(CanTripInfoHandler* _canTripInfoHandler, CanRadioRemoteMessageHandler* _canRadioRemoteMessageHandler)
+    VanRadioRemoteHandler(VanHandlerContext& context)
     {
-        canTripInfoHandler = _canTripInfoHandler;
-        canRadioRemoteMessageHandler = _canRadioRemoteMessageHandler;
+        _events = context.Events;
     }
 
+    const static uint16_t IDENT = VAN_ID_RADIO_REMOTE;
+    const static uint8_t LENGTH = 2;
+    // every frame is forwarded to the CAN bus
+    const static bool PROCESS_UNCHANGED_PAYLOAD = true;
+
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_RADIO_REMOTE) && messageLength == 2))
+        const VanRadioRemotePacket* packet = frame.As<VanRadioRemotePacket>();
+        if (packet == nullptr)
         {
             return false;
         }
 
-        const VanRadioRemotePacket packet = DeSerialize<VanRadioRemotePacket>(vanMessageWithoutId);
-        dataToBridge->RadioRemoteButton = packet.VanRadioRemotePacket[0];
-        dataToBridge->RadioRemoteScroll = packet.VanRadioRemotePacket[1];
+        dataToBridge->RadioRemoteButton = packet->VanRadioRemotePacket[0];
+        dataToBridge->RadioRemoteScroll = packet->VanRadioRemotePacket[1];
 
-        canRadioRemoteMessageHandler->SetData(dataToBridge->RadioRemoteButton, dataToBridge->RadioRemoteScroll);
+        BridgeEvent event;
+        event.Type = BRIDGE_EVENT_RADIO_REMOTE;
+        event.RadioRemote.Button = dataToBridge->RadioRemoteButton;
+        event.RadioRemote.Scroll = dataToBridge->RadioRemoteScroll;
+        _events->Push(event);
 
-        if (packet.data.RemoteButton.seek_down_pressed && packet.data.RemoteButton.seek_up_pressed)
+        if (packet->data.RemoteButton.seek_down_pressed && packet->data.RemoteButton.seek_up_pressed)
         {
-            canTripInfoHandler->TripButtonPress();
+            _events->Push(BRIDGE_EVENT_TRIP_BUTTON_PRESSED);
         }
 
         return true;
@@ -9,36 +9,38 @@
 #include "../../Helpers/VanDataToBridgeToCan.h"
 #include "../../Helpers/VanIgnitionDataToBridgeToCan.h"
 #include "../../Helpers/DoorStatus.h"
-#include "../../Helpers/Serializer.h"
 
 #include "../Structs/VanSpeedAndRpmStructs.h"
+#include "../Generated/VanSignals.h"
 
 class VanSpeedAndRpmHandler : public AbstractVanMessageHandler {
-    ~VanSpeedAndRpmHandler()
-    {
+    SignalBus* _signals;
+
+public:
+    const static uint16_t IDENT = VAN_ID_SPEED_RPM;
+    const static uint8_t LENGTH = VAN_ID_SPEED_RPM_LENGTH;
 
+    VanSpeedAndRpmHandler(VanHandlerContext& context)
+    {
+        _signals = context.Signals;
     }
 
-public:
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
-        DoorStatus& doorStatus) override
+        DoorStatus& doorStatus)
     {
-        if (!(IsVanIdent(identByte1, identByte2, VAN_ID_SPEED_RPM) && messageLength == VAN_ID_SPEED_RPM_LENGTH))
+        if (frame.GetLength() < VanSpeedAndRpmSignals::LENGTH)
         {
             return false;
         }
 
-        const VanSpeedAndRpmPacket packet = DeSerialize<VanSpeedAndRpmPacket>(vanMessageWithoutId);
-
-        dataToBridge->Rpm = GetRpmFromVanData(packet.data.Rpm.data);
-        dataToBridge->Speed = GetSpeedFromVanData(packet.data.Speed.data);
-        dataToBridge->Distance = packet.data.Distance.data;
+        const uint8_t* payload = frame.GetPayload();
+        const unsigned long currentTime = millis();
+        _signals->Publish(SIGNAL_RPM, VanSpeedAndRpmSignals::GetRpm(payload), currentTime);
+        _signals->Publish(SIGNAL_SPEED, VanSpeedAndRpmSignals::GetSpeed(payload), currentTime);
+        _signals->Publish(SIGNAL_DISTANCE, VanSpeedAndRpmSignals::GetDistance(payload), currentTime);
 
         return true;
     }
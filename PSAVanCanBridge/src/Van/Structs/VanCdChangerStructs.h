@@ -84,10 +84,10 @@ class VanCdChangerPacketSender
         packet.data.Footer = headerByte;
 
         //printf("sending speed: %d (%#x)\n", x, x);
-        unsigned char *serializedPacket = Serialize<VanCdChangerPacket>(packet);
+        unsigned char serializedPacket[sizeof(VanCdChangerPacket)];
+        Serialize<VanCdChangerPacket>(packet, serializedPacket);
         vanMessageSender->set_channel_for_immediate_reply_message(channelId, VAN_ID_CD_CHANGER, serializedPacket, sizeof(packet));
         memset(&packet, 0, 0);
-        delete[] serializedPacket;
     }
 
     uint8_t DecimalToBcd(uint8_t input)
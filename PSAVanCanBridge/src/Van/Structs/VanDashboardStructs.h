@@ -105,10 +105,10 @@ class VanDashboardPacketSender
         packet.data.MileageByte3 = 0x90; //0x1A6E90 = 173224.0 meters
         packet.data.ExternalTemperature.value = GetTemperatureToSendToDisplay(externalTemperature);
 
-        unsigned char *serializedPacket = Serialize<VanDashboardPacket>(packet);
+        unsigned char serializedPacket[sizeof(VanDashboardPacket)];
+        Serialize<VanDashboardPacket>(packet, serializedPacket);
         vanMessageSender->set_channel_for_transmit_message(channelId, VAN_ID_DASHBOARD, serializedPacket, sizeof(packet), 0);
         memset(&packet, 0, 0);
-        delete[] serializedPacket;
     }
 };
 #pragma endregion
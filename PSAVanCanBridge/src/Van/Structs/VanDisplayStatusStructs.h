@@ -54,10 +54,10 @@ class VanDisplayStatusPacketSender
 
         packet.data.OverSpeedAlertValue = 0x1E;
 
-        unsigned char *serializedPacket = Serialize<VanDisplayStatusPacket>(packet);
+        unsigned char serializedPacket[sizeof(VanDisplayStatusPacket)];
+        Serialize<VanDisplayStatusPacket>(packet, serializedPacket);
         vanMessageSender->set_channel_for_transmit_message(channelId, VAN_ID_DISPLAY_STATUS, serializedPacket, sizeof(packet), 1);
         memset(&packet, 0, 0);
-        delete[] serializedPacket;
     }
 
     void Disable(uint8_t channelId)
@@ -197,7 +197,8 @@ class VanDisplayPacketV1Sender
         VanDisplayPacketV1 packet;
         memset(&packet, 0, sizeof(packet));//fill everything with 0 - https://stackoverflow.com/a/6891737/5453350
 
-        unsigned char *serializedPacket = Serialize<VanDisplayPacketV1>(packet);
+        unsigned char serializedPacket[sizeof(VanDisplayPacketV1)];
+        Serialize<VanDisplayPacketV1>(packet, serializedPacket);
 
         // display messages are best to test with everything set to FF, because that way every message type apppears
 
@@ -218,7 +219,6 @@ class VanDisplayPacketV1Sender
 
         vanMessageSender->set_channel_for_transmit_message(channelId, VAN_ID_DISPLAY_POPUP_V1, serializedPacket, sizeof(packet), 0);
         memset(&packet, 0, 0);
-        delete[] serializedPacket;
     }
 };
 #pragma endregion
@@ -200,7 +200,8 @@ class VanDisplayV2PacketSender
         VanDisplayPacketV2 packet;
         memset(&packet, 0, sizeof(packet));//fill everything with 0 - https://stackoverflow.com/a/6891737/5453350
 
-        unsigned char *serializedPacket = Serialize<VanDisplayPacketV2>(packet);
+        unsigned char serializedPacket[sizeof(VanDisplayPacketV2)];
+        Serialize<VanDisplayPacketV2>(packet, serializedPacket);
 
         // display messages are best to test with everything set to FF, because that way every message type apppears
 
@@ -223,7 +224,6 @@ class VanDisplayV2PacketSender
 
         vanMessageSender->set_channel_for_transmit_message(channelId, VAN_ID_DISPLAY_POPUP_V2, serializedPacket, sizeof(packet), 0);
         memset(&packet, 0, 0);
-        delete[] serializedPacket;
     }
 };
 #pragma endregion
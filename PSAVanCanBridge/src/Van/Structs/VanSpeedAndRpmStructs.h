@@ -83,10 +83,10 @@ class VanSpeedAndRpmPacketSender
         packet.data.Speed.data = 10;
         packet.data.Distance.data = distance;
 
-        unsigned char *serializedPacket = Serialize<VanSpeedAndRpmPacket>(packet);
+        unsigned char serializedPacket[sizeof(VanSpeedAndRpmPacket)];
+        Serialize<VanSpeedAndRpmPacket>(packet, serializedPacket);
         vanMessageSender->set_channel_for_transmit_message(channelId, VAN_ID_SPEED_RPM, serializedPacket, sizeof(packet), 0);
         memset(&packet, 0, 0);
-        delete[] serializedPacket;
     }
 };
 #pragma endregion
@@ -0,0 +1,125 @@
+// VanCrc15.h
+#pragma once
+
+#ifndef _VanCrc15_h
+    #define _VanCrc15_h
+
+#include <stdint.h>
+
+/*
+    VAN frame check sequence: CRC-15, polynomial 0x0F9D, initial value 0x7FFF, result inverted.
+    On the bus it takes 16 bits, the CRC is sent in the upper 15 bits followed by a 0 bit.
+
+    The register is kept shifted left by one bit, so the 15 bit CRC lines up with a 16 bit MSB-first table
+    and the result is already in the form it has on the bus. The table is const, so it stays in flash.
+*/
+static const uint16_t VAN_CRC15_TABLE[256] = {
+    0x0000, 0x1F3A, 0x3E74, 0x214E, 0x7CE8, 0x63D2, 0x429C, 0x5DA6,
+    0xF9D0, 0xE6EA, 0xC7A4, 0xD89E, 0x8538, 0x9A02, 0xBB4C, 0xA476,
+    0xEC9A, 0xF3A0, 0xD2EE, 0xCDD4, 0x9072, 0x8F48, 0xAE06, 0xB13C,
+    0x154A, 0x0A70, 0x2B3E, 0x3404, 0x69A2, 0x7698, 0x57D6, 0x48EC,
+    0xC60E, 0xD934, 0xF87A, 0xE740, 0xBAE6, 0xA5DC, 0x8492, 0x9BA8,
+    0x3FDE, 0x20E4, 0x01AA, 0x1E90, 0x4336, 0x5C0C, 0x7D42, 0x6278,
+    0x2A94, 0x35AE, 0x14E0, 0x0BDA, 0x567C, 0x4946, 0x6808, 0x7732,
+    0xD344, 0xCC7E, 0xED30, 0xF20A, 0xAFAC, 0xB096, 0x91D8, 0x8EE2,
+    0x9326, 0x8C1C, 0xAD52, 0xB268, 0xEFCE, 0xF0F4, 0xD1BA, 0xCE80,
+    0x6AF6, 0x75CC, 0x5482, 0x4BB8, 0x161E, 0x0924, 0x286A, 0x3750,
+    0x7FBC, 0x6086, 0x41C8, 0x5EF2, 0x0354, 0x1C6E, 0x3D20, 0x221A,
+    0x866C, 0x9956, 0xB818, 0xA722, 0xFA84, 0xE5BE, 0xC4F0, 0xDBCA,
+    0x5528, 0x4A12, 0x6B5C, 0x7466, 0x29C0, 0x36FA, 0x17B4, 0x088E,
+    0xACF8, 0xB3C2, 0x928C, 0x8DB6, 0xD010, 0xCF2A, 0xEE64, 0xF15E,
+    0xB9B2, 0xA688, 0x87C6, 0x98FC, 0xC55A, 0xDA60, 0xFB2E, 0xE414,
+    0x4062, 0x5F58, 0x7E16, 0x612C, 0x3C8A, 0x23B0, 0x02FE, 0x1DC4,
+    0x3976, 0x264C, 0x0702, 0x1838, 0x459E, 0x5AA4, 0x7BEA, 0x64D0,
+    0xC0A6, 0xDF9C, 0xFED2, 0xE1E8, 0xBC4E, 0xA374, 0x823A, 0x9D00,
+    0xD5EC, 0xCAD6, 0xEB98, 0xF4A2, 0xA904, 0xB63E, 0x9770, 0x884A,
+    0x2C3C, 0x3306, 0x1248, 0x0D72, 0x50D4, 0x4FEE, 0x6EA0, 0x719A,
+    0xFF78, 0xE042, 0xC10C, 0xDE36, 0x8390, 0x9CAA, 0xBDE4, 0xA2DE,
+    0x06A8, 0x1992, 0x38DC, 0x27E6, 0x7A40, 0x657A, 0x4434, 0x5B0E,
+    0x13E2, 0x0CD8, 0x2D96, 0x32AC, 0x6F0A, 0x7030, 0x517E, 0x4E44,
+    0xEA32, 0xF508, 0xD446, 0xCB7C, 0x96DA, 0x89E0, 0xA8AE, 0xB794,
+    0xAA50, 0xB56A, 0x9424, 0x8B1E, 0xD6B8, 0xC982, 0xE8CC, 0xF7F6,
+    0x5380, 0x4CBA, 0x6DF4, 0x72CE, 0x2F68, 0x3052, 0x111C, 0x0E26,
+    0x46CA, 0x59F0, 0x78BE, 0x6784, 0x3A22, 0x2518, 0x0456, 0x1B6C,
+    0xBF1A, 0xA020, 0x816E, 0x9E54, 0xC3F2, 0xDCC8, 0xFD86, 0xE2BC,
+    0x6C5E, 0x7364, 0x522A, 0x4D10, 0x10B6, 0x0F8C, 0x2EC2, 0x31F8,
+    0x958E, 0x8AB4, 0xABFA, 0xB4C0, 0xE966, 0xF65C, 0xD712, 0xC828,
+    0x80C4, 0x9FFE, 0xBEB0, 0xA18A, 0xFC2C, 0xE316, 0xC258, 0xDD62,
+    0x7914, 0x662E, 0x4760, 0x585A, 0x05FC, 0x1AC6, 0x3B88, 0x24B2,
+};
+
+class VanCrc15 {
+    const static uint16_t POLYNOMIAL_SHIFTED = 0x0F9D << 1;
+    const static uint16_t INITIAL_VALUE_SHIFTED = 0x7FFF << 1;
+    const static uint16_t FINAL_XOR_SHIFTED = 0x7FFF << 1;
+
+    // start of frame byte the receiver puts in front of each frame, it is not covered by the CRC
+    const static uint8_t VAN_SOF_LENGTH = 1;
+    const static uint8_t VAN_CRC_LENGTH = 2;
+
+    uint16_t _crc;
+
+public:
+    VanCrc15()
+    {
+        Reset();
+    }
+
+    #pragma region Streaming
+    void Reset()
+    {
+        _crc = INITIAL_VALUE_SHIFTED;
+    }
+
+    void Update(uint8_t data)
+    {
+        _crc = (_crc << 8) ^ VAN_CRC15_TABLE[(uint8_t)((_crc >> 8) ^ data)];
+    }
+
+    void Update(const uint8_t data[], uint8_t length)
+    {
+        for (uint8_t i = 0; i < length; i++)
+        {
+            Update(data[i]);
+        }
+    }
+
+    /* Feeds a single bit, for decoders which do not have a whole byte yet */
+    void UpdateBit(uint8_t bit)
+    {
+        const bool feedback = ((_crc >> 15) ^ bit) & 1;
+        _crc <<= 1;
+        if (feedback)
+        {
+            _crc ^= POLYNOMIAL_SHIFTED;
+        }
+    }
+
+    /* Returns the CRC of the data fed so far, as the two CRC bytes appear on the bus (high byte first) */
+    uint16_t GetCrc() const
+    {
+        return (_crc ^ FINAL_XOR_SHIFTED) & 0xFFFE;
+    }
+    #pragma endregion
+
+    static uint16_t Compute(const uint8_t data[], uint8_t length)
+    {
+        VanCrc15 crc;
+        crc.Update(data, length);
+        return crc.GetCrc();
+    }
+
+    /* Checks a frame as read from the receiver (SOF, ident, payload, CRC) */
+    static bool IsFrameCrcOk(const uint8_t frame[], uint8_t frameLength)
+    {
+        if (frameLength < VAN_SOF_LENGTH + VAN_CRC_LENGTH)
+        {
+            return false;
+        }
+
+        const uint16_t crcInFrame = frame[frameLength - 2] << 8 | frame[frameLength - 1];
+        return Compute(frame + VAN_SOF_LENGTH, frameLength - VAN_SOF_LENGTH - VAN_CRC_LENGTH) == crcInFrame;
+    }
+};
+
+#endif
@@ -14,15 +14,10 @@
 #include "Structs/VanVinStructs.h"
 #include "Handlers/AbstractVanMessageHandler.h"
 
+#include "VanFrameView.h"
 #include "VanHandlerContainer.h"
 
 class VanDataParserTask {
-    uint8_t identByte1;
-    uint8_t identByte2;
-    uint8_t vanMessageLengthWithoutId;
-
-    uint8_t vanMessageWithoutId[32];
-
     DoorStatus doorStatus;
 
     AbsSer* _serialPort;
@@ -44,29 +39,27 @@ class VanDataParserTask {
         doorStatus.asByte = 0;
     }
 
-    void ProcessData(uint8_t vanMessage[], uint8_t vanMessageLength, VanDataToBridgeToCan *dataToBridgeToCan, VanIgnitionDataToBridgeToCan *ignitionDataToBridgeToCan, VanVinToBridgeToCan *vanVinToBridgeToCan) {
-        if (vanMessageLength > 0 && vanMessage[0] == 0x0E)
+    /* Returns true if a handler (or the VIN reader) used the frame */
+    bool ProcessData(const VanFrameView& frame, VanDataToBridgeToCan *dataToBridgeToCan, VanIgnitionDataToBridgeToCan *ignitionDataToBridgeToCan, VanVinToBridgeToCan *vanVinToBridgeToCan) {
+        if (frame.IsValid())
         {
-            identByte1 = vanMessage[1];
-            identByte2 = vanMessage[2];
-            vanMessageLengthWithoutId = vanMessageLength - 5;
-
-            //make a copy of the buffer excluding the ids and the crc (otherwise deserializing the packet gives wrong results)
-            memcpy(vanMessageWithoutId, vanMessage + 3, vanMessageLengthWithoutId);
-
-            const bool vanMessageHandled = _vanHandlerContainer->ProcessMessage(identByte1, identByte2, vanMessageWithoutId, vanMessageLengthWithoutId, dataToBridgeToCan, ignitionDataToBridgeToCan, doorStatus);
+            bool vanMessageHandled = _vanHandlerContainer->ProcessMessage(frame, dataToBridgeToCan, ignitionDataToBridgeToCan, doorStatus);
 
             #pragma region Vin
-            if (IsVanIdent(identByte1, identByte2, VAN_ID_VIN))
+            if (frame.GetIdent() == VAN_ID_VIN)
             {
                 if (!_canVinHandler->IsVinSet())
                 {
-                    memcpy(vanVinToBridgeToCan->Vin, vanMessageWithoutId, vanMessageLengthWithoutId);
+                    const uint8_t vinLength = frame.GetLength() < sizeof(vanVinToBridgeToCan->Vin) ? frame.GetLength() : sizeof(vanVinToBridgeToCan->Vin);
+                    memcpy(vanVinToBridgeToCan->Vin, frame.GetPayload(), vinLength);
                 }
+                vanMessageHandled = true;
             }
             #pragma endregion
+
+            return vanMessageHandled;
         }
-        vanMessageLength = 0;
+        return false;
     }
  };
 
@@ -0,0 +1,118 @@
+// VanFrameRing.h
+#pragma once
+
+#ifndef _VanFrameRing_h
+    #define _VanFrameRing_h
+
+#include <stdint.h>
+#include <atomic>
+
+const uint8_t VAN_RAW_FRAME_MAX_LENGTH = 34;
+
+/* A raw VAN frame as read from the receiver (SOF byte, ident, payload, CRC) */
+struct VanRawFrame {
+    // value of micros() when the frame was taken from the receiver
+    unsigned long Timestamp;
+    uint8_t Length;
+    uint8_t Data[VAN_RAW_FRAME_MAX_LENGTH];
+};
+
+/*
+    Fixed capacity single producer, single consumer ring of raw VAN frames.
+    The producer (receiver task) writes straight into the slot returned by GetWriteSlot() and publishes it with Commit(),
+    the consumer (parser task) reads the oldest frame with Peek() and frees it with Release().
+    No locks are taken, so the two sides can run on different cores.
+*/
+class VanFrameRing {
+public:
+    // must be a power of two
+    const static uint8_t CAPACITY = 32;
+
+private:
+    const static uint8_t INDEX_MASK = CAPACITY - 1;
+
+    VanRawFrame frames[CAPACITY];
+
+    // written only by the producer
+    std::atomic<uint8_t> head;
+    // written only by the consumer
+    std::atomic<uint8_t> tail;
+
+    std::atomic<uint32_t> droppedCount;
+    std::atomic<uint8_t> highWaterMark;
+
+public:
+    VanFrameRing() : head(0), tail(0), droppedCount(0), highWaterMark(0)
+    {
+    }
+
+    #pragma region Producer side
+    /* Returns the slot the next frame can be written to, or nullptr if the ring is full */
+    VanRawFrame* GetWriteSlot()
+    {
+        const uint8_t currentHead = head.load(std::memory_order_relaxed);
+        const uint8_t currentTail = tail.load(std::memory_order_acquire);
+
+        if ((uint8_t)(currentHead - currentTail) >= CAPACITY)
+        {
+            return nullptr;
+        }
+        return &frames[currentHead & INDEX_MASK];
+    }
+
+    /* Publishes the frame written to the slot returned by GetWriteSlot() */
+    void Commit()
+    {
+        const uint8_t newHead = head.load(std::memory_order_relaxed) + 1;
+        head.store(newHead, std::memory_order_release);
+
+        const uint8_t count = newHead - tail.load(std::memory_order_relaxed);
+        if (count > highWaterMark.load(std::memory_order_relaxed))
+        {
+            highWaterMark.store(count, std::memory_order_relaxed);
+        }
+    }
+
+    /* Called by the producer when a frame was received but the ring was full */
+    void CountDropped()
+    {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    #pragma endregion
+
+    #pragma region Consumer side
+    /* Returns the oldest frame in the ring, or nullptr if the ring is empty */
+    VanRawFrame* Peek()
+    {
+        const uint8_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail == head.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        return &frames[currentTail & INDEX_MASK];
+    }
+
+    /* Frees the frame returned by Peek() */
+    void Release()
+    {
+        tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+    #pragma endregion
+
+    uint8_t GetCount()
+    {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    uint32_t GetDroppedCount()
+    {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+
+    uint8_t GetHighWaterMark()
+    {
+        return highWaterMark.load(std::memory_order_relaxed);
+    }
+};
+
+#endif
@@ -0,0 +1,108 @@
+// VanFrameView.h
+#pragma once
+
+#ifndef _VanFrameView_h
+    #define _VanFrameView_h
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+    Non-owning view of the payload of a received VAN frame (the bytes between the ident and the CRC).
+    The view points into the receive buffer, so it is only valid until that buffer is released.
+    Every accessor is bounds checked against the payload length.
+*/
+class VanFrameView {
+    // start of frame byte the receiver puts in front of each frame
+    const static uint8_t VAN_SOF_BYTE = 0x0E;
+    // start of frame byte + 2 ident bytes
+    const static uint8_t VAN_HEADER_LENGTH = 3;
+    const static uint8_t VAN_CRC_LENGTH = 2;
+
+    const uint8_t* _payload;
+    uint8_t _length;
+    uint16_t _ident;
+    unsigned long _timestamp;
+
+public:
+    VanFrameView() : _payload(nullptr), _length(0), _ident(0), _timestamp(0)
+    {
+    }
+
+    VanFrameView(const uint8_t payload[], uint8_t length, uint16_t ident, unsigned long timestamp) :
+        _payload(payload), _length(length), _ident(ident), _timestamp(timestamp)
+    {
+    }
+
+    /* Creates the view from a frame as read from the receiver (SOF, ident, payload, CRC), returns an invalid view if the frame is malformed */
+    static VanFrameView FromRawFrame(const uint8_t frame[], uint8_t frameLength, unsigned long timestamp)
+    {
+        if (frameLength < VAN_HEADER_LENGTH + VAN_CRC_LENGTH || frame[0] != VAN_SOF_BYTE)
+        {
+            return VanFrameView();
+        }
+
+        // concatenates the two bytes and removes the last digit (the command nibble)
+        const uint16_t ident = (frame[1] << 8 | frame[2]) >> 4;
+        return VanFrameView(frame + VAN_HEADER_LENGTH, frameLength - VAN_HEADER_LENGTH - VAN_CRC_LENGTH, ident, timestamp);
+    }
+
+    bool IsValid() const
+    {
+        return _payload != nullptr;
+    }
+
+    uint16_t GetIdent() const
+    {
+        return _ident;
+    }
+
+    uint8_t GetLength() const
+    {
+        return _length;
+    }
+
+    const uint8_t* GetPayload() const
+    {
+        return _payload;
+    }
+
+    /* Value of micros() when the frame was taken from the receiver */
+    unsigned long GetTimestamp() const
+    {
+        return _timestamp;
+    }
+
+    /* Returns the byte at the given payload index, or 0 if the frame is shorter */
+    uint8_t GetByte(uint8_t index) const
+    {
+        return index < _length ? _payload[index] : 0;
+    }
+
+    /* Reads two bytes the way the packet structs do (low byte first), returns 0 if the frame is shorter */
+    uint16_t GetUInt16(uint8_t index) const
+    {
+        return index + 1 < _length ? (_payload[index + 1] << 8 | _payload[index]) : 0;
+    }
+
+    /*
+        Returns the payload as a packet without copying it, or nullptr if the frame is shorter than the packet.
+        Only packets made of single bytes can be mapped in place, anything else has to be read with ReadPacket().
+    */
+    template <class T> const T* As() const
+    {
+        static_assert(alignof(T) == 1, "packet needs alignment, use ReadPacket() instead");
+        return sizeof(T) <= _length ? reinterpret_cast<const T*>(_payload) : nullptr;
+    }
+
+    /* Copies the payload into a packet, bytes the frame does not have are left zero */
+    template <class T> T ReadPacket() const
+    {
+        T packet;
+        memset(&packet, 0, sizeof(packet));
+        memcpy(&packet, _payload, sizeof(packet) < _length ? sizeof(packet) : _length);
+        return packet;
+    }
+};
+
+#endif
@@ -27,67 +27,203 @@
 #include "Handlers/VanEmfBsiRequestHandler.h"
 #include "Handlers/VanBsiEventsHandler.h"
 
+#include "VanFrameView.h"
+#include "VanHandlerRegistry.h"
+#include "VanPayloadCache.h"
+#include "../SerialPort/AbstractSerial.h"
+
+/* The handlers of the received VAN frames, adding or removing a handler is one line here */
+typedef VanHandlerRegistry<
+    VanAirConditioner1Handler,
+    VanAirConditioner2Handler,
+    VanCarStatusWithTripComputerHandler,
+    VanDashboardHandler,
+    VanDisplayHandlerV2,
+    VanDisplayHandlerV1,
+    VanInstrumentClusterHandlerV2,
+    VanInstrumentClusterHandlerV1,
+    VanRadioRemoteHandler,
+    VanSpeedAndRpmHandler,
+    VanAirConditionerDiagSensorHandler,
+    VanAirConditionerDiagActuatorHandler,
+    VanParkingAidDiagDistanceHandler,
+    VanPositionForRt3Handler,
+    //VanBsiEventsHandler,
+    VanEmfBsiRequestHandler
+> VanHandlers;
+
+/* One case of the dispatch switch, the positions past the end of the list are never in the ident table */
+#define VAN_HANDLER_CASE(index) \
+    case index: \
+        return ProcessFrom(VanHandlerIndex<(index < VAN_MESSAGE_HANDLER_COUNT ? index : NO_HANDLER)>(), frame, dataToBridge, ignitionDataToBridge, doorStatus);
+
 class VanHandlerContainer {
-    const static uint8_t VAN_MESSAGE_HANDLER_COUNT = 15;
-    AbstractVanMessageHandler* vanMessageHandlers[VAN_MESSAGE_HANDLER_COUNT];
+    const static uint8_t VAN_MESSAGE_HANDLER_COUNT = VanHandlers::COUNT;
+    const static uint16_t VAN_IDENT_COUNT = 4096;
+    const static uint8_t NO_HANDLER = VanHandlers::NO_HANDLER;
+    // the number of cases in ProcessMessage()
+    const static uint8_t VAN_HANDLER_CASE_COUNT = 24;
+
+    static_assert(VAN_MESSAGE_HANDLER_COUNT <= VAN_HANDLER_CASE_COUNT, "add cases to the switch in ProcessMessage()");
+
+    // the handlers registered with VAN_IDENT_ANY, they are called with every frame
+    const static uint8_t FIRST_ANY_IDENT_HANDLER = VanHandlerFindIdent<VanHandlers, VAN_IDENT_ANY, 0>::VALUE;
+
+    VanHandlerContext context;
+    VanHandlers handlers;
+
+    VanHandlerSlot handlerSlots[VAN_MESSAGE_HANDLER_COUNT];
+    VanPayloadCache payloadCaches[VAN_MESSAGE_HANDLER_COUNT];
+
+    /* First handler registered for each 12 bit ident, the handlers after it with the same ident are known at compile time */
+    uint8_t handlerIndexByIdent[VAN_IDENT_COUNT];
 
-    VanCanAirConditionerSpeedMap* vanCanAirConditionerSpeedMap;
-    VanCanDisplayPopupMap* popupMapping;
+    void BuildIdentTable()
+    {
+        handlers.GetSlots(handlerSlots);
+
+        memset(handlerIndexByIdent, NO_HANDLER, sizeof(handlerIndexByIdent));
+
+        // iterate backwards, so the first handler of the list wins when several share an ident
+        for (int8_t i = VAN_MESSAGE_HANDLER_COUNT - 1; i >= 0; i--)
+        {
+            const uint16_t ident = handlerSlots[i].Ident;
+
+            if (ident != VAN_IDENT_ANY)
+            {
+                handlerIndexByIdent[ident & (VAN_IDENT_COUNT - 1)] = i;
+            }
+        }
+    }
+
+    template <class THandler>
+    bool ProcessWithHandler(
+        THandler& handler,
+        VanPayloadCache& payloadCache,
+        const VanFrameView& frame,
+        VanDataToBridgeToCan *dataToBridge,
+        VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
+        DoorStatus& doorStatus)
+    {
+        if (THandler::PROCESS_UNCHANGED_PAYLOAD)
+        {
+            return handler.ProcessMessage(frame, dataToBridge, ignitionDataToBridge, doorStatus);
+        }
+
+        bool result = false;
+        if (payloadCache.IsUnchanged(frame, result))
+        {
+            return result;
+        }
+
+        result = handler.ProcessMessage(frame, dataToBridge, ignitionDataToBridge, doorStatus);
+        payloadCache.Store(frame, result);
+        return result;
+    }
+
+    /* Offers the frame to the handler at Index, then to the handlers after it with the same ident, until one handles it */
+    template <uint8_t Index>
+    bool ProcessFrom(
+        VanHandlerIndex<Index>,
+        const VanFrameView& frame,
+        VanDataToBridgeToCan *dataToBridge,
+        VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
+        DoorStatus& doorStatus)
+    {
+        typedef VanHandlers::HandlerAt<Index> THandler;
+
+        // the handlers sharing an ident are told apart by the length of their frames
+        if ((THandler::LENGTH == VAN_LENGTH_ANY || THandler::LENGTH == frame.GetLength()) &&
+            ProcessWithHandler(handlers.Get<Index>(), payloadCaches[Index], frame, dataToBridge, ignitionDataToBridge, doorStatus))
+        {
+            return true;
+        }
+
+        return ProcessFrom(
+            VanHandlerIndex<VanHandlerNextWithSameIdent<VanHandlers, Index>::VALUE>(),
+            frame, dataToBridge, ignitionDataToBridge, doorStatus);
+    }
+
+    bool ProcessFrom(
+        VanHandlerIndex<NO_HANDLER>,
+        const VanFrameView& frame,
+        VanDataToBridgeToCan *dataToBridge,
+        VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
+        DoorStatus& doorStatus)
+    {
+        return false;
+    }
 
     public:
     VanHandlerContainer(
-        ICanDisplayPopupHandler* canPopupHandler,
-        CanTripInfoHandler* canTripInfoHandler,
-        CanStatusOfFunctionsHandler* canStatusOfFunctionsHandler,
-        CanWarningLogHandler* canWarningLogHandler,
-        CanRadioRemoteMessageHandler* canRadioRemoteMessageHandler
-    ) {
-        vanCanAirConditionerSpeedMap = new VanCanAirConditionerSpeedMap();
-        popupMapping = new VanCanDisplayPopupMap();
-
-        vanMessageHandlers[0] = new VanAirConditioner1Handler(vanCanAirConditionerSpeedMap);
-        vanMessageHandlers[1] = new VanAirConditioner2Handler();
-        vanMessageHandlers[2] = new VanCarStatusWithTripComputerHandler(canPopupHandler, canTripInfoHandler);
-        vanMessageHandlers[3] = new VanDashboardHandler();
-
-        vanMessageHandlers[4] = new VanDisplayHandlerV2(canPopupHandler, canTripInfoHandler, popupMapping, canStatusOfFunctionsHandler, canWarningLogHandler);
-        vanMessageHandlers[5] = new VanDisplayHandlerV1(vanMessageHandlers[4]);
-
-        vanMessageHandlers[6] = new VanInstrumentClusterHandlerV2();
-        vanMessageHandlers[7] = new VanInstrumentClusterHandlerV1(vanMessageHandlers[6]);
-
-        vanMessageHandlers[8] = new VanRadioRemoteHandler(canTripInfoHandler, canRadioRemoteMessageHandler);
-        vanMessageHandlers[9] = new VanSpeedAndRpmHandler();
-        vanMessageHandlers[10] = new VanAirConditionerDiagSensorHandler();
-        vanMessageHandlers[11] = new VanAirConditionerDiagActuatorHandler();
-        vanMessageHandlers[12] = new VanParkingAidDiagDistanceHandler();
-        vanMessageHandlers[13] = new VanPositionForRt3Handler();
-        vanMessageHandlers[14] = new VanEmfBsiRequestHandler(canTripInfoHandler);
-        //vanMessageHandlers[15] = new VanBsiEventsHandler(canTripInfoHandler);
+        BridgeEventQueue* eventQueue,
+        SignalBus* signalBus
+    ) :
+        context(eventQueue, signalBus),
+        handlers(context)
+    {
+        BuildIdentTable();
     }
 
     bool ProcessMessage(
-        const uint8_t identByte1,
-        const uint8_t identByte2,
-        const uint8_t vanMessageWithoutId[],
-        const uint8_t messageLength,
+        const VanFrameView& frame,
         VanDataToBridgeToCan *dataToBridge,
         VanIgnitionDataToBridgeToCan *ignitionDataToBridge,
         DoorStatus& doorStatus)
     {
-        bool vanMessageHandled = false;
+        if (ProcessFrom(VanHandlerIndex<FIRST_ANY_IDENT_HANDLER>(), frame, dataToBridge, ignitionDataToBridge, doorStatus))
+        {
+            return true;
+        }
+
+        switch (handlerIndexByIdent[frame.GetIdent() & (VAN_IDENT_COUNT - 1)])
+        {
+            VAN_HANDLER_CASE(0) VAN_HANDLER_CASE(1) VAN_HANDLER_CASE(2) VAN_HANDLER_CASE(3)
+            VAN_HANDLER_CASE(4) VAN_HANDLER_CASE(5) VAN_HANDLER_CASE(6) VAN_HANDLER_CASE(7)
+            VAN_HANDLER_CASE(8) VAN_HANDLER_CASE(9) VAN_HANDLER_CASE(10) VAN_HANDLER_CASE(11)
+            VAN_HANDLER_CASE(12) VAN_HANDLER_CASE(13) VAN_HANDLER_CASE(14) VAN_HANDLER_CASE(15)
+            VAN_HANDLER_CASE(16) VAN_HANDLER_CASE(17) VAN_HANDLER_CASE(18) VAN_HANDLER_CASE(19)
+            VAN_HANDLER_CASE(20) VAN_HANDLER_CASE(21) VAN_HANDLER_CASE(22) VAN_HANDLER_CASE(23)
+            default:
+                return false;
+        }
+    }
+
+    /* Prints how many frames each cached handler skipped because their payload did not change */
+    void PrintPayloadCacheStatistics(AbsSer* serialPort)
+    {
+        uint32_t totalHitCount = 0;
+        uint32_t totalFrameCount = 0;
 
         for (uint8_t i = 0; i < VAN_MESSAGE_HANDLER_COUNT; i++)
         {
-            vanMessageHandled = vanMessageHandlers[i]->ProcessMessage(identByte1, identByte2, vanMessageWithoutId, messageLength, dataToBridge, ignitionDataToBridge, doorStatus);
-            if (vanMessageHandled)
+            if (handlerSlots[i].ProcessUnchangedPayload)
             {
-                break;
+                continue;
             }
+
+            const uint32_t hitCount = payloadCaches[i].GetHitCount();
+            const uint32_t frameCount = hitCount + payloadCaches[i].GetMissCount();
+            totalHitCount += hitCount;
+            totalFrameCount += frameCount;
+
+            serialPort->print(handlerSlots[i].Ident, HEX);
+            serialPort->print(" len ");
+            serialPort->print(handlerSlots[i].Length);
+            serialPort->print(": ");
+            serialPort->print(hitCount);
+            serialPort->print("/");
+            serialPort->print(frameCount);
+            serialPort->println(" unchanged");
         }
 
-        return vanMessageHandled;
+        serialPort->print("Unchanged payloads skipped: ");
+        serialPort->print(totalHitCount);
+        serialPort->print("/");
+        serialPort->println(totalFrameCount);
     }
 };
 
+#undef VAN_HANDLER_CASE
+
 #endif
@@ -0,0 +1,153 @@
+// VanHandlerRegistry.h
+#pragma once
+
+#ifndef _VanHandlerRegistry_h
+    #define _VanHandlerRegistry_h
+
+#include "../Helpers/VanDataToBridgeToCan.h"
+#include "../Helpers/VanIgnitionDataToBridgeToCan.h"
+#include "../Helpers/DoorStatus.h"
+
+#include "Handlers/VanHandlerContext.h"
+#include "VanFrameView.h"
+
+/* Where a handler of the registry is registered, the ident table and the statistics are built from it */
+struct VanHandlerSlot {
+    uint16_t Ident;
+    uint8_t Length;
+    bool ProcessUnchangedPayload;
+};
+
+/* The position of a handler in the list, as a type, so the handler to call is chosen at compile time */
+template <uint8_t Index>
+struct VanHandlerIndex {
+    const static uint8_t VALUE = Index;
+};
+
+/* The handler type at a position of the list */
+template <uint8_t Index, class... THandlers> struct VanHandlerAt;
+
+template <class THandler, class... TOtherHandlers>
+struct VanHandlerAt<0, THandler, TOtherHandlers...> {
+    typedef THandler Type;
+};
+
+template <uint8_t Index, class THandler, class... TOtherHandlers>
+struct VanHandlerAt<Index, THandler, TOtherHandlers...> {
+    typedef typename VanHandlerAt<Index - 1, TOtherHandlers...>::Type Type;
+};
+
+template <uint8_t Index> struct VanHandlerAccess;
+
+/*
+    Holds one instance of every handler type in the list, without heap allocation.
+    The handlers are constructed in the order of the list from the same VanHandlerContext.
+*/
+template <class... THandlers> class VanHandlerList;
+
+template <> class VanHandlerList<> {
+public:
+    VanHandlerList(VanHandlerContext&)
+    {
+    }
+
+    void GetSlots(VanHandlerSlot[])
+    {
+    }
+};
+
+template <class THandler, class... TOtherHandlers>
+class VanHandlerList<THandler, TOtherHandlers...> {
+    template <uint8_t Index> friend struct VanHandlerAccess;
+
+    THandler handler;
+    VanHandlerList<TOtherHandlers...> otherHandlers;
+
+public:
+    VanHandlerList(VanHandlerContext& context) : handler(context), otherHandlers(context)
+    {
+    }
+
+    /* Fills one slot per handler, in the order of the list */
+    void GetSlots(VanHandlerSlot slots[])
+    {
+        slots[0].Ident = THandler::IDENT;
+        slots[0].Length = THandler::LENGTH;
+        slots[0].ProcessUnchangedPayload = THandler::PROCESS_UNCHANGED_PAYLOAD;
+
+        otherHandlers.GetSlots(slots + 1);
+    }
+};
+
+template <uint8_t Index>
+struct VanHandlerAccess {
+    template <class THandler, class... TOtherHandlers>
+    static typename VanHandlerAt<Index, THandler, TOtherHandlers...>::Type& Get(VanHandlerList<THandler, TOtherHandlers...>& list)
+    {
+        return VanHandlerAccess<Index - 1>::Get(list.otherHandlers);
+    }
+};
+
+template <>
+struct VanHandlerAccess<0> {
+    template <class THandler, class... TOtherHandlers>
+    static THandler& Get(VanHandlerList<THandler, TOtherHandlers...>& list)
+    {
+        return list.handler;
+    }
+};
+
+/*
+    The handlers of the received VAN frames. The container dispatches a frame with a switch over the positions of the list,
+    every case calls its handler through the concrete type, so there is no indirect call and a small handler is inlined.
+*/
+template <class... THandlers>
+class VanHandlerRegistry {
+    VanHandlerList<THandlers...> handlers;
+
+public:
+    const static uint8_t COUNT = sizeof...(THandlers);
+    /* The position of no handler, ends the chain of handlers sharing an ident */
+    const static uint8_t NO_HANDLER = 0xFF;
+
+    static_assert(COUNT < NO_HANDLER, "too many VAN handlers");
+
+    template <uint8_t Index>
+    using HandlerAt = typename VanHandlerAt<Index, THandlers...>::Type;
+
+    VanHandlerRegistry(VanHandlerContext& context) : handlers(context)
+    {
+    }
+
+    template <uint8_t Index>
+    HandlerAt<Index>& Get()
+    {
+        return VanHandlerAccess<Index>::Get(handlers);
+    }
+
+    void GetSlots(VanHandlerSlot slots[])
+    {
+        handlers.GetSlots(slots);
+    }
+};
+
+/* The first position from Index on which holds a handler of the ident, or NO_HANDLER */
+template <class TRegistry, uint16_t Ident, uint8_t Index, bool IsPastEnd = (Index >= TRegistry::COUNT)>
+struct VanHandlerFindIdent {
+    const static uint8_t VALUE = TRegistry::template HandlerAt<Index>::IDENT == Ident
+        ? Index
+        : VanHandlerFindIdent<TRegistry, Ident, Index + 1>::VALUE;
+};
+
+template <class TRegistry, uint16_t Ident, uint8_t Index>
+struct VanHandlerFindIdent<TRegistry, Ident, Index, true> {
+    const static uint8_t VALUE = TRegistry::NO_HANDLER;
+};
+
+/* The next handler after Index which is registered for the same ident (V1/V2 display, diagnostic answers of different lengths) */
+template <class TRegistry, uint8_t Index>
+struct VanHandlerNextWithSameIdent {
+    const static uint8_t VALUE = VanHandlerFindIdent<TRegistry, TRegistry::template HandlerAt<Index>::IDENT, Index + 1>::VALUE;
+};
+
+#endif
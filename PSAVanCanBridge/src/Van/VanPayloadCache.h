@@ -0,0 +1,93 @@
+// VanPayloadCache.h
+#pragma once
+
+#ifndef _VanPayloadCache_h
+    #define _VanPayloadCache_h
+
+#include <stdint.h>
+#include <string.h>
+
+#include "VanFrameView.h"
+
+/*
+    Remembers the last payload a handler processed, so a periodic frame repeating the same bytes
+    does not have to be decoded again. A hash of the payload rejects most changed frames at once,
+    an equal hash is confirmed with a byte compare.
+*/
+class VanPayloadCache {
+    // the longest payload a VAN frame can carry
+    const static uint8_t MAX_PAYLOAD_LENGTH = 28;
+    // an unchanged payload is still processed this often (in microseconds), so state derived from other frames can catch up
+    const static unsigned long MAX_SUPPRESS_TIME = 1000000;
+
+    uint8_t payload[MAX_PAYLOAD_LENGTH];
+    uint8_t length = 0;
+    uint16_t hash = 0;
+    bool isValid = false;
+    bool lastResult = false;
+    unsigned long lastProcessedTime = 0;
+
+    uint32_t hitCount = 0;
+    uint32_t missCount = 0;
+
+    static uint16_t GetHash(const uint8_t data[], uint8_t dataLength)
+    {
+        // FNV-1a folded to 16 bits
+        uint32_t result = 2166136261UL;
+        for (uint8_t i = 0; i < dataLength; i++)
+        {
+            result = (result ^ data[i]) * 16777619UL;
+        }
+        return (uint16_t)(result ^ (result >> 16));
+    }
+
+public:
+    /* Returns true if the payload is the same as the last processed one, result is set to what the handler returned for it */
+    bool IsUnchanged(const VanFrameView& frame, bool& result)
+    {
+        const uint16_t frameHash = GetHash(frame.GetPayload(), frame.GetLength());
+
+        if (isValid
+            && frameHash == hash
+            && frame.GetLength() == length
+            && frame.GetTimestamp() - lastProcessedTime < MAX_SUPPRESS_TIME
+            && memcmp(frame.GetPayload(), payload, length) == 0)
+        {
+            hitCount++;
+            result = lastResult;
+            return true;
+        }
+
+        missCount++;
+        hash = frameHash;
+        isValid = false;
+        return false;
+    }
+
+    /* Stores the payload the handler just processed along with its result */
+    void Store(const VanFrameView& frame, bool result)
+    {
+        if (frame.GetLength() > MAX_PAYLOAD_LENGTH)
+        {
+            return;
+        }
+
+        length = frame.GetLength();
+        memcpy(payload, frame.GetPayload(), length);
+        lastResult = result;
+        lastProcessedTime = frame.GetTimestamp();
+        isValid = true;
+    }
+
+    uint32_t GetHitCount()
+    {
+        return hitCount;
+    }
+
+    uint32_t GetMissCount()
+    {
+        return missCount;
+    }
+};
+
+#endif
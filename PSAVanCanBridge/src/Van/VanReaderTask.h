@@ -0,0 +1,146 @@
+// VanReaderTask.h
+#pragma once
+
+#ifndef _VanReaderTask_h
+    #define _VanReaderTask_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WProgram.h"
+#endif
+
+#include "../../Config.h"
+#include "../Helpers/SharedSnapshot.h"
+#include "../Helpers/VanDataToBridgeToCan.h"
+#include "../Helpers/VanIgnitionDataToBridgeToCan.h"
+#include "../Helpers/VanVinToBridgeToCan.h"
+#include "../SerialPort/AbstractSerial.h"
+#include "IVanMessageReader.h"
+#include "VanDataParserTask.h"
+#include "VanFrameRing.h"
+#include "VanFrameView.h"
+#include "VanTrafficStatistics.h"
+
+/*
+    Takes the frames the VAN receive task put into the frame ring, checks their CRC and hands them to the handlers.
+    The handlers fill the working copies owned by this task, which are published to the CAN tasks once per cycle.
+*/
+class VanReaderTask {
+    IVanMessageReader* _vanReader;
+    VanFrameRing* _frameRing;
+    VanDataParserTask* _vanDataParserTask;
+    VanTrafficStatistics* _vanTrafficStatistics;
+    AbsSer* _serialPort;
+
+    // working copies, the other tasks read the published snapshots
+    VanDataToBridgeToCan dataToBridge;
+    VanIgnitionDataToBridgeToCan ignitionDataToBridge;
+    VanVinToBridgeToCan vinDataToBridge;
+
+    uint32_t reportedDroppedCount = 0;
+
+    void PrintArrayToSerial(const uint8_t vanMessage[], uint8_t vanMessageLength)
+    {
+        char tmp[3];
+        for (uint8_t i = 0; i < vanMessageLength; i++)
+        {
+            snprintf(tmp, 3, "%02X", vanMessage[i]);
+            if (i != vanMessageLength - 1)
+            {
+                _serialPort->print(tmp);
+                _serialPort->print(" ");
+            }
+            else
+            {
+                _serialPort->println(tmp);
+            }
+        }
+    }
+
+    void ProcessFrame(VanRawFrame* frame)
+    {
+        const VanFrameView frameView = VanFrameView::FromRawFrame(frame->Data, frame->Length, frame->Timestamp);
+
+        if (_vanReader->IsCrcOk(frame->Data, frame->Length))
+        {
+            if (true)
+            {
+                PrintArrayToSerial(frame->Data, frame->Length);
+            }
+
+            const bool handled = _vanDataParserTask->ProcessData(frameView, &dataToBridge, &ignitionDataToBridge, &vinDataToBridge);
+
+            if (frameView.IsValid())
+            {
+                _vanTrafficStatistics->RecordFrame(frameView.GetIdent(), frameView.GetTimestamp(), handled);
+            }
+        }
+        else
+        {
+            if (frameView.IsValid())
+            {
+                _vanTrafficStatistics->RecordCrcError(frameView.GetIdent());
+            }
+
+            if (LOG_MSG_WITH_CRC_ERROR)
+            {
+                _serialPort->print("CRC ERROR: ");
+                PrintArrayToSerial(frame->Data, frame->Length);
+            }
+        }
+    }
+
+public:
+    VanReaderTask(
+        IVanMessageReader* vanReader,
+        VanFrameRing* frameRing,
+        VanDataParserTask* vanDataParserTask,
+        VanTrafficStatistics* vanTrafficStatistics,
+        AbsSer* serialPort
+    ) : dataToBridge(), ignitionDataToBridge(), vinDataToBridge()
+    {
+        _vanReader = vanReader;
+        _frameRing = frameRing;
+        _vanDataParserTask = vanDataParserTask;
+        _vanTrafficStatistics = vanTrafficStatistics;
+        _serialPort = serialPort;
+    }
+
+    /* Processes every frame in the ring, then publishes the working copies */
+    void ReadData(
+        SharedSnapshot<VanDataToBridgeToCan>& dataToBridgeSnapshot,
+        SharedSnapshot<VanIgnitionDataToBridgeToCan>& ignitionDataToBridgeSnapshot,
+        SharedSnapshot<VanVinToBridgeToCan>& vinDataToBridgeSnapshot)
+    {
+        VanRawFrame* frame;
+        while ((frame = _frameRing->Peek()) != nullptr)
+        {
+            ProcessFrame(frame);
+            _frameRing->Release();
+        }
+
+        const uint32_t droppedCount = _frameRing->GetDroppedCount();
+        if (droppedCount != reportedDroppedCount)
+        {
+            reportedDroppedCount = droppedCount;
+            _serialPort->print("VAN frames dropped: ");
+            _serialPort->print(droppedCount);
+            _serialPort->print(" ring high water mark: ");
+            _serialPort->println(_frameRing->GetHighWaterMark());
+        }
+
+        if (!USE_IGNITION_SIGNAL_FROM_VAN_BUS)
+        {
+            dataToBridge.Ignition = 1;
+            ignitionDataToBridge.Ignition = 1;
+            ignitionDataToBridge.EconomyModeActive = 0;
+        }
+
+        dataToBridgeSnapshot.Write(dataToBridge);
+        ignitionDataToBridgeSnapshot.Write(ignitionDataToBridge);
+        vinDataToBridgeSnapshot.Write(vinDataToBridge);
+    }
+};
+
+#endif
@@ -0,0 +1,77 @@
+// VanReceiverTask.h
+#pragma once
+
+#ifndef _VanReceiverTask_h
+    #define _VanReceiverTask_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WProgram.h"
+#endif
+
+#include "IVanMessageReader.h"
+#include "VanFrameRing.h"
+#include "../Helpers/SerialReader.h"
+
+/* Moves every frame available from the receiver (or the serial port) into the frame ring */
+class VanReceiverTask {
+    IVanMessageReader* _vanReader;
+    SerialReader* _serialReader;
+    VanFrameRing* _frameRing;
+
+    // frames received while the ring is full are read here and thrown away
+    uint8_t discardBuffer[VAN_RAW_FRAME_MAX_LENGTH];
+
+public:
+    VanReceiverTask(
+        IVanMessageReader* vanReader,
+        SerialReader* serialReader,
+        VanFrameRing* frameRing
+    )
+    {
+        _vanReader = vanReader;
+        _serialReader = serialReader;
+        _frameRing = frameRing;
+    }
+
+    /* Returns the number of frames put into the ring */
+    uint8_t ReceiveData()
+    {
+        uint8_t receivedCount = 0;
+
+        for (;;)
+        {
+            VanRawFrame* frame = _frameRing->GetWriteSlot();
+            uint8_t* buffer = frame != nullptr ? frame->Data : discardBuffer;
+            uint8_t length = 0;
+
+            _serialReader->Receive(&length, buffer);
+
+            if (length == 0)
+            {
+                _vanReader->Receive(&length, buffer);
+            }
+
+            if (length == 0)
+            {
+                break;
+            }
+
+            if (frame == nullptr)
+            {
+                _frameRing->CountDropped();
+                continue;
+            }
+
+            frame->Timestamp = micros();
+            frame->Length = length;
+            _frameRing->Commit();
+            receivedCount++;
+        }
+
+        return receivedCount;
+    }
+};
+
+#endif
@@ -0,0 +1,153 @@
+// VanTrafficStatistics.h
+#pragma once
+
+#ifndef _VanTrafficStatistics_h
+    #define _VanTrafficStatistics_h
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../SerialPort/AbstractSerial.h"
+
+/* Traffic counters of a single VAN ident */
+struct VanIdentStatistics {
+    uint16_t Ident;
+    uint32_t ReceivedCount;
+    uint32_t CrcErrorCount;
+    uint32_t UnhandledCount;
+    // inter-arrival times of frames with a good CRC (in microseconds)
+    uint32_t MinInterval;
+    uint32_t MaxInterval;
+    uint64_t IntervalSum;
+    uint32_t IntervalCount;
+    // value of micros() when the last frame with a good CRC arrived
+    unsigned long LastSeen;
+};
+
+/*
+    Per ident statistics of the received VAN frames, used to find out the real bus rates of a car.
+    Only the VAN read task updates the counters, other tasks may print them (the values of an ident can be mid-update then).
+*/
+class VanTrafficStatistics {
+    // a car sends about 30 different idents, the rest of the table leaves room for the diagnostic ones
+    const static uint8_t MAX_IDENT_COUNT = 48;
+
+    VanIdentStatistics identStatistics[MAX_IDENT_COUNT];
+    uint8_t identCount = 0;
+
+    // frames that could not be put in the table: the table was full, or the ident of a frame with a CRC error was never seen before
+    uint32_t otherFrameCount = 0;
+
+    VanIdentStatistics* Find(uint16_t ident)
+    {
+        for (uint8_t i = 0; i < identCount; i++)
+        {
+            if (identStatistics[i].Ident == ident)
+            {
+                return &identStatistics[i];
+            }
+        }
+        return nullptr;
+    }
+
+    VanIdentStatistics* Add(uint16_t ident)
+    {
+        if (identCount == MAX_IDENT_COUNT)
+        {
+            return nullptr;
+        }
+
+        VanIdentStatistics* statistics = &identStatistics[identCount];
+        memset(statistics, 0, sizeof(VanIdentStatistics));
+        statistics->Ident = ident;
+        statistics->MinInterval = UINT32_MAX;
+        identCount++;
+        return statistics;
+    }
+
+public:
+    /* Counts a frame with a good CRC */
+    void RecordFrame(uint16_t ident, unsigned long timestamp, bool handled)
+    {
+        VanIdentStatistics* statistics = Find(ident);
+        if (statistics == nullptr)
+        {
+            statistics = Add(ident);
+            if (statistics == nullptr)
+            {
+                otherFrameCount++;
+                return;
+            }
+        }
+
+        // the first frame with a good CRC has no interval yet
+        if (statistics->ReceivedCount > statistics->CrcErrorCount)
+        {
+            const uint32_t interval = timestamp - statistics->LastSeen;
+            if (interval < statistics->MinInterval)
+            {
+                statistics->MinInterval = interval;
+            }
+            if (interval > statistics->MaxInterval)
+            {
+                statistics->MaxInterval = interval;
+            }
+            statistics->IntervalSum += interval;
+            statistics->IntervalCount++;
+        }
+
+        statistics->ReceivedCount++;
+        if (!handled)
+        {
+            statistics->UnhandledCount++;
+        }
+        statistics->LastSeen = timestamp;
+    }
+
+    /* Counts a frame with a CRC error, its ident is only trusted if it was already seen with a good CRC */
+    void RecordCrcError(uint16_t ident)
+    {
+        VanIdentStatistics* statistics = Find(ident);
+        if (statistics == nullptr)
+        {
+            otherFrameCount++;
+            return;
+        }
+
+        statistics->ReceivedCount++;
+        statistics->CrcErrorCount++;
+    }
+
+    /* Prints one line per ident: ident, received, CRC errors, unhandled, min/avg/max interval (us), time since last seen (ms) */
+    void Print(AbsSer* serialPort, unsigned long currentTime)
+    {
+        serialPort->println("ident received crc unhandled min avg max age");
+
+        for (uint8_t i = 0; i < identCount; i++)
+        {
+            const VanIdentStatistics& statistics = identStatistics[i];
+            const uint32_t averageInterval = statistics.IntervalCount > 0 ? (uint32_t)(statistics.IntervalSum / statistics.IntervalCount) : 0;
+
+            serialPort->print(statistics.Ident, HEX);
+            serialPort->print(" ");
+            serialPort->print(statistics.ReceivedCount);
+            serialPort->print(" ");
+            serialPort->print(statistics.CrcErrorCount);
+            serialPort->print(" ");
+            serialPort->print(statistics.UnhandledCount);
+            serialPort->print(" ");
+            serialPort->print(statistics.IntervalCount > 0 ? statistics.MinInterval : 0);
+            serialPort->print(" ");
+            serialPort->print(averageInterval);
+            serialPort->print(" ");
+            serialPort->print(statistics.MaxInterval);
+            serialPort->print(" ");
+            serialPort->println((currentTime - statistics.LastSeen) / 1000);
+        }
+
+        serialPort->print("other: ");
+        serialPort->println(otherFrameCount);
+    }
+};
+
+#endif
@@ -0,0 +1,51 @@
+// VanTransmitScheduler.h
+#pragma once
+
+#ifndef _VanTransmitScheduler_h
+    #define _VanTransmitScheduler_h
+
+#include "Writers/VanMessageWriterBase.h"
+
+/*
+    Gives the VAN writers channels on the TSS463, so they can be armed at the same time, and runs the writers at their own intervals.
+    The display status is the exception, it shares the channel of the trip computer query (see VanWriterContainer).
+*/
+class VanTransmitScheduler
+{
+    const static uint8_t MAX_WRITER_COUNT = 8;
+
+    VanMessageWriterBase* writers[MAX_WRITER_COUNT];
+    uint8_t writerCount = 0;
+    uint8_t nextFreeChannel = 0;
+
+public:
+    // the TSS463 has 15 channels (0-14)
+    const static uint8_t TSS463_CHANNEL_COUNT = 15;
+
+    /* Reserves channelCount consecutive channels and returns the first one */
+    uint8_t AssignChannels(uint8_t channelCount)
+    {
+        const uint8_t firstChannel = nextFreeChannel;
+        nextFreeChannel += channelCount;
+        return firstChannel;
+    }
+
+    void Register(VanMessageWriterBase* writer)
+    {
+        if (writerCount < MAX_WRITER_COUNT)
+        {
+            writers[writerCount] = writer;
+            writerCount++;
+        }
+    }
+
+    void Process(unsigned long currentTime)
+    {
+        for (uint8_t i = 0; i < writerCount; i++)
+        {
+            writers[i]->Process(currentTime);
+        }
+    }
+};
+
+#endif
@@ -7,70 +7,71 @@
 #include "../../Config.h"
 
 #include "../Van/AbstractVanMessageSender.h"
+#include "VanTransmitScheduler.h"
 #include "Writers/VanQueryTripComputer.h"
 #include "Writers/VanQueryAirCon.h"
 #include "Writers/VanQueryParkingAid.h"
 #include "Writers/VanDisplayStatus.h"
 #include "../Helpers/VanIgnitionDataToBridgeToCan.h"
+#include "../Helpers/StaticInstance.h"
 
 class VanWriterContainer {
-    AbstractVanMessageSender* vanInterface;
-    VanQueryTripComputer* tripComputerQuery;
-    VanQueryAirCon* acQuery;
-    VanQueryParkingAid* parkingAidQuery;
-    VanDisplayStatus* displayStatus;
+    static_assert(
+        VanQueryTripComputer::CHANNEL_COUNT + VanQueryAirCon::CHANNEL_COUNT + VanQueryParkingAid::CHANNEL_COUNT
+            <= VanTransmitScheduler::TSS463_CHANNEL_COUNT,
+        "the VAN writers need more channels than the TSS463 has");
 
-    uint8_t _sendTripDataQuery = 0;
+    AbstractVanMessageSender* vanInterface;
+    VanTransmitScheduler transmitScheduler;
+    // the writers arm their channels when they are constructed, so the optional ones are only created if they are enabled
+    StaticInstance<VanQueryTripComputer> tripComputerQuery;
+    StaticInstance<VanQueryAirCon> acQuery;
+    StaticInstance<VanQueryParkingAid> parkingAidQuery;
+    StaticInstance<VanDisplayStatus> displayStatus;
 
     public:
 
     VanWriterContainer(AbstractVanMessageSender* VANInterface) {
         vanInterface = VANInterface;
 
-        tripComputerQuery = new VanQueryTripComputer(vanInterface);
-        displayStatus = new VanDisplayStatus(vanInterface);
+        // the channels are reserved even for the disabled writers, so every writer keeps its channels: trip computer 0, A/C 1-4, parking aid 5-7
+        const uint8_t tripComputerChannel = transmitScheduler.AssignChannels(VanQueryTripComputer::CHANNEL_COUNT);
+        const uint8_t acChannel = transmitScheduler.AssignChannels(VanQueryAirCon::CHANNEL_COUNT);
+        const uint8_t parkingAidChannel = transmitScheduler.AssignChannels(VanQueryParkingAid::CHANNEL_COUNT);
+
+        transmitScheduler.Register(tripComputerQuery.Create(vanInterface, tripComputerChannel));
+
+        // We use the same channel for the status as the trip computer query because otherwise it clashes somehow
+        transmitScheduler.Register(displayStatus.Create(vanInterface, tripComputerChannel));
+        displayStatus->ShareChannels(tripComputerQuery.Get());
 
         if (QUERY_AC_STATUS)
         {
-            acQuery = new VanQueryAirCon(vanInterface);
+            transmitScheduler.Register(acQuery.Create(vanInterface, acChannel));
         }
 
         if(QUERY_PARKING_AID_DISTANCE)
         {
-            parkingAidQuery = new VanQueryParkingAid(vanInterface);
+            transmitScheduler.Register(parkingAidQuery.Create(vanInterface, parkingAidChannel));
         }
     }
 
-    void Process(VanIgnitionDataToBridgeToCan ignitionData, unsigned long currentTime)
+    void Process(const VanIgnitionDataToBridgeToCan& ignitionData, unsigned long currentTime)
     {
-        if (_sendTripDataQuery == 1)
-        {
-            displayStatus->Stop();
-            delay(5);
-            tripComputerQuery->SetData(ignitionData.Ignition);
-            tripComputerQuery->Process(currentTime);
-            _sendTripDataQuery = 0;
-        }
-        else
-        {
-            tripComputerQuery->Stop();
-            delay(5);
-            displayStatus->SetData(ignitionData.Ignition, ignitionData.TripButtonPressed, currentTime);
-            displayStatus->Process(currentTime);
-            _sendTripDataQuery = 1;
-        }
+        tripComputerQuery->SetData(ignitionData.Ignition);
+        displayStatus->SetData(ignitionData.Ignition, ignitionData.TripButtonPressed, currentTime);
 
         if (QUERY_AC_STATUS)
         {
             acQuery->SetData(ignitionData.Ignition);
-            acQuery->Process(currentTime);
         }
 
         if(QUERY_PARKING_AID_DISTANCE)
         {
             parkingAidQuery->SetData(ignitionData.Ignition, ignitionData.IsReverseEngaged);
-            parkingAidQuery->Process(currentTime);
         }
+
+        transmitScheduler.Process(currentTime);
     }
 };
 
@@ -5,11 +5,13 @@
 
 #include "VanMessageSender.h"
 #include "VanWriterContainer.h"
+#include "../Helpers/StaticInstance.h"
 
 class VanWriterTask {
-    VanWriterContainer* vanWriterContainer;
-    SPIClass* spi;
-    AbstractVanMessageSender* VANInterface;
+    // the sender can only be constructed after the SPI bus is started
+    StaticInstance<VanWriterContainer> vanWriterContainer;
+    SPIClass spi;
+    StaticInstance<VanMessageSender> VANInterface;
 
 public:
     VanWriterTask()
@@ -19,17 +21,16 @@ class VanWriterTask {
         const int MOSI_PIN = 33;
         const int VAN_PIN = 32;
 
-        spi = new SPIClass();
-        spi->begin(SCK_PIN, MISO_PIN, MOSI_PIN, VAN_PIN);
+        spi.begin(SCK_PIN, MISO_PIN, MOSI_PIN, VAN_PIN);
 
-        VANInterface = new VanMessageSender(VAN_PIN, spi, VAN_COMFORT);
+        VANInterface.Create(VAN_PIN, &spi, VAN_COMFORT);
         VANInterface->begin();
 
-        vanWriterContainer = new VanWriterContainer(VANInterface);
+        vanWriterContainer.Create(VANInterface.Get());
 
     }
 
-    void Process(VanIgnitionDataToBridgeToCan dataToBridge, unsigned long currentTime)
+    void Process(const VanIgnitionDataToBridgeToCan& dataToBridge, unsigned long currentTime)
     {
         vanWriterContainer->Process(dataToBridge, currentTime);
     }
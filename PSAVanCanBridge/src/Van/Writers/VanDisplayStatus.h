@@ -11,9 +11,7 @@
 class VanDisplayStatus : public VanMessageWriterBase
 {
     const static uint16_t SEND_STATUS_INTERVAL = 420;
-    const static uint8_t SEND_RESET_COUNT = 1;
 
-    // We use the same channel for the status as the trip computer query because otherwise it clashes somehow
     const static uint8_t  SEND_STATUS_CHANNEL = 0;
 
     uint8_t _tripButtonState = 0;
@@ -22,16 +20,7 @@ class VanDisplayStatus : public VanMessageWriterBase
     unsigned long _tripButtonPressedTime = 0;
     uint8_t _ignition = 0;
 
-    VanDisplayStatusPacketSender* displayStatusSender;
-
-    void SendStatus(uint8_t resetTrip)
-    {
-        for (int i = 0; i < SEND_RESET_COUNT; ++i)
-        {
-            displayStatusSender->SendStatus(SEND_STATUS_CHANNEL, resetTrip);
-            delay(5);
-        }
-    }
+    VanDisplayStatusPacketSender displayStatusSender;
 
     virtual void InternalProcess() override
     {
@@ -39,21 +28,27 @@ class VanDisplayStatus : public VanMessageWriterBase
         {
             if (_resetTrip == 1 && _resetSent == 0)
             {
-                SendStatus(1);
+                displayStatusSender.SendStatus(GetChannel(SEND_STATUS_CHANNEL), 1);
                 _resetTrip = 0;
                 _resetSent = 1;
             }
             else
             {
-                displayStatusSender->SendStatus(SEND_STATUS_CHANNEL, 0);
+                displayStatusSender.SendStatus(GetChannel(SEND_STATUS_CHANNEL), 0);
             }
         }
+        else
+        {
+            SetIdle();
+        }
     }
 
     public:
-    VanDisplayStatus(AbstractVanMessageSender* vanMessageSender) : VanMessageWriterBase(vanMessageSender, SEND_STATUS_INTERVAL)
+    const static uint8_t CHANNEL_COUNT = 1;
+
+    VanDisplayStatus(AbstractVanMessageSender* vanMessageSender, uint8_t firstChannel)
+        : VanMessageWriterBase(vanMessageSender, SEND_STATUS_INTERVAL, firstChannel, CHANNEL_COUNT), displayStatusSender(vanMessageSender)
     {
-        displayStatusSender = new VanDisplayStatusPacketSender(vanMessageSender);
     }
 
     void SetData(uint8_t ignition, uint8_t tripButton, unsigned long currentTime)
@@ -78,12 +73,6 @@ class VanDisplayStatus : public VanMessageWriterBase
             }
         }
     }
-
-    void Stop()
-    {
-        displayStatusSender->Disable(SEND_STATUS_CHANNEL);
-    }
-
 };
 
 #endif
@@ -6,31 +6,96 @@
 
 #include "../AbstractVanMessageSender.h"
 
+/* The last arming of a group of channels, the writers sharing their channels share this as well */
+struct VanChannelLease {
+    bool IsArmed = false;
+    unsigned long ArmedTime = 0;
+    // after this the transfer is considered lost and the channels can be armed again
+    unsigned long Timeout = 0;
+};
+
+/*
+    Arms its TSS463 channels every processInterval milliseconds. Most writers have channels of their own (see VanTransmitScheduler),
+    the ones sharing channels (see ShareChannels) take turns. Before arming the channels again it checks (without waiting) whether
+    the previous transfer finished: while one is still in progress the writer retries in the next cycle, but not longer than two intervals
+    of the writer which armed the channels.
+*/
 class VanMessageWriterBase
 {
     unsigned long _previousTime = 0;
+    VanChannelLease _ownLease;
+    VanChannelLease* _lease = &_ownLease;
 
     virtual void InternalProcess() = 0;
 
+    bool IsTransferInProgress(unsigned long currentTime)
+    {
+        if (!_lease->IsArmed || currentTime - _lease->ArmedTime > _lease->Timeout)
+        {
+            return false;
+        }
+
+        for (uint8_t i = 0; i < _channelCount; i++)
+        {
+            const MessageLengthAndStatusRegister status = _vanMessageSender->message_available(GetChannel(i));
+            if (!status.data.CHTx && !status.data.CHRx && !status.data.CHER)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     protected:
     uint16_t _processInterval = 40;
+    uint8_t _firstChannel = 0;
+    uint8_t _channelCount = 1;
     unsigned long _currentTime = 0;
 
     AbstractVanMessageSender* _vanMessageSender;
 
-    VanMessageWriterBase(AbstractVanMessageSender* object, uint16_t interval)
+    VanMessageWriterBase(AbstractVanMessageSender* object, uint16_t interval, uint8_t firstChannel, uint8_t channelCount)
     {
         _processInterval = interval;
+        _firstChannel = firstChannel;
+        _channelCount = channelCount;
         _vanMessageSender = object;
     }
 
+    /* Returns the channel with the given index among the channels of the writer */
+    uint8_t GetChannel(uint8_t index)
+    {
+        return _firstChannel + index;
+    }
+
+    /* Called by the writers which stopped sending (for example the ignition is off), so the next cycle doesn't wait for them */
+    void SetIdle()
+    {
+        _lease->IsArmed = false;
+    }
+
     public:
+    /* Uses the channels of the owner instead of channels of its own, the two writers never arm them at the same time */
+    void ShareChannels(VanMessageWriterBase* owner)
+    {
+        _firstChannel = owner->_firstChannel;
+        _lease = owner->_lease;
+    }
+
     void Process(unsigned long currentTime)
     {
         if (currentTime - _previousTime > _processInterval)
         {
+            if (IsTransferInProgress(currentTime))
+            {
+                return;
+            }
+
             _previousTime = currentTime;
             _currentTime = currentTime;
+            _lease->IsArmed = true;
+            _lease->ArmedTime = currentTime;
+            _lease->Timeout = 2 * _processInterval;
 
             InternalProcess();
         }
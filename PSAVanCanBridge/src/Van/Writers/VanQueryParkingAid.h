@@ -12,29 +12,36 @@ class VanQueryParkingAid : public VanMessageWriterBase
 {
     const static uint16_t PARKING_AID_QUERY_INTERVAL = 120;
 
-    const static uint8_t PARKING_AID_DIAG_START_CHANNEL = 5;
-    const static uint8_t PARKING_AID_DIAG_QUERY_DISTANCE_CHANNEL = 6;
-    const static uint8_t PARKING_AID_DIAG_DATA_CHANNEL = 7;
+    // indexes among the channels of the writer
+    const static uint8_t PARKING_AID_DIAG_START_CHANNEL = 0;
+    const static uint8_t PARKING_AID_DIAG_QUERY_DISTANCE_CHANNEL = 1;
+    const static uint8_t PARKING_AID_DIAG_DATA_CHANNEL = 2;
 
     uint8_t _ignition = 0;
     uint8_t _isReverseEngaged = 0;
 
-    VanParkingAidDiagPacketSender* parkingAidDiagSender;
+    VanParkingAidDiagPacketSender parkingAidDiagSender;
 
     virtual void InternalProcess() override
     {
         if (_ignition == 1 && _isReverseEngaged == 1)
         {
-            parkingAidDiagSender->GetManufacturerInfo(PARKING_AID_DIAG_START_CHANNEL);
-            parkingAidDiagSender->GetDistance(PARKING_AID_DIAG_QUERY_DISTANCE_CHANNEL);
-            parkingAidDiagSender->QueryParkingRadarData(PARKING_AID_DIAG_DATA_CHANNEL);
+            parkingAidDiagSender.GetManufacturerInfo(GetChannel(PARKING_AID_DIAG_START_CHANNEL));
+            parkingAidDiagSender.GetDistance(GetChannel(PARKING_AID_DIAG_QUERY_DISTANCE_CHANNEL));
+            parkingAidDiagSender.QueryParkingRadarData(GetChannel(PARKING_AID_DIAG_DATA_CHANNEL));
+        }
+        else
+        {
+            SetIdle();
         }
     }
 
     public:
-        VanQueryParkingAid(AbstractVanMessageSender* vanMessageSender) : VanMessageWriterBase(vanMessageSender, PARKING_AID_QUERY_INTERVAL)
+        const static uint8_t CHANNEL_COUNT = 3;
+
+        VanQueryParkingAid(AbstractVanMessageSender* vanMessageSender, uint8_t firstChannel)
+            : VanMessageWriterBase(vanMessageSender, PARKING_AID_QUERY_INTERVAL, firstChannel, CHANNEL_COUNT), parkingAidDiagSender(vanMessageSender)
     {
-            parkingAidDiagSender = new VanParkingAidDiagPacketSender(vanMessageSender);
     }
 
     void SetData(uint8_t ignition, uint8_t isReverseEngaged)
@@ -15,32 +15,33 @@ class VanQueryTripComputer : public VanMessageWriterBase
 
     uint8_t _ignition = 0;
 
-    VanCarStatusPacketSender* carStatusSender;
+    VanCarStatusPacketSender carStatusSender;
 
     virtual void InternalProcess() override
     {
         if (_ignition)
         {
-            carStatusSender->GetCarStatus(TRIP_COMPUTER_CHANNEL);
+            carStatusSender.GetCarStatus(GetChannel(TRIP_COMPUTER_CHANNEL));
+        }
+        else
+        {
+            SetIdle();
         }
     }
 
     public:
-    VanQueryTripComputer(AbstractVanMessageSender* vanMessageSender) : VanMessageWriterBase(vanMessageSender, TRIP_COMPUTER_QUERY_INTERVAL)
+    const static uint8_t CHANNEL_COUNT = 1;
+
+    VanQueryTripComputer(AbstractVanMessageSender* vanMessageSender, uint8_t firstChannel)
+        : VanMessageWriterBase(vanMessageSender, TRIP_COMPUTER_QUERY_INTERVAL, firstChannel, CHANNEL_COUNT), carStatusSender(vanMessageSender)
     {
-        carStatusSender = new VanCarStatusPacketSender(vanMessageSender);
-        carStatusSender->GetCarStatus(TRIP_COMPUTER_CHANNEL);
+        carStatusSender.GetCarStatus(GetChannel(TRIP_COMPUTER_CHANNEL));
     }
 
     void SetData(uint8_t ignition)
     {
         _ignition = ignition;
     }
-
-    void Stop()
-    {
-        carStatusSender->Disable(TRIP_COMPUTER_CHANNEL);
-    }
 };
 
 #endif
@@ -0,0 +1,181 @@
+// BitFieldTest.cpp
+// The BitField descriptors (and the codecs generated from them) read the received bytes directly, they must give the same
+// values as copying the packet into its struct of bitfields (the way the handlers read them before) for every byte value.
+// The benchmarks compare the two ways on the frames of the hot path.
+
+#include <chrono>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arduino.h"
+#include "TestCheck.h"
+#include "Can/Structs/CanMenuStructs.h"
+#include "Can/Structs/CanDisplayMenuStructs.h"
+#include "Can/Structs/CanRadioStructs.h"
+#include "Can/Structs/CanRadioTunerStructs.h"
+#include "Can/Structs/CanDisplayStructs.h"
+#include "Van/Structs/VanParkingAidDiagStructs.h"
+#include "Van/Generated/VanSignals.h"
+
+/* Every byte value in every position of the packet, the other bytes random */
+template <class Packet, class Check>
+static void ForEachPayload(Check check)
+{
+    uint8_t data[sizeof(Packet)];
+    for (size_t position = 0; position < sizeof(Packet); position++)
+    {
+        for (int value = 0; value < 256; value++)
+        {
+            for (size_t i = 0; i < sizeof(Packet); i++)
+            {
+                data[i] = (uint8_t)rand();
+            }
+            data[position] = (uint8_t)value;
+            check(data, DeSerialize<Packet>(data));
+        }
+    }
+}
+
+static void TestGet()
+{
+    ForEachPayload<CanMenuPacket>([](const uint8_t* data, const CanMenuPacket& packet) {
+        CHECK_EQUAL(packet.data.EscOkField.esc, CanMenuEscButtonField::Get(data));
+    });
+    ForEachPayload<CanDisplayMenuPacket>([](const uint8_t* data, const CanDisplayMenuPacket& packet) {
+        CHECK_EQUAL(packet.data.Byte1.menu_open, CanDisplayMenuOpenField::Get(data));
+    });
+    ForEachPayload<CanRadioPacket>([](const uint8_t* data, const CanRadioPacket& packet) {
+        CHECK_EQUAL(packet.data.Field1.radio_enabled, CanRadioEnabledField::Get(data));
+        CHECK_EQUAL(packet.data.Source.source, CanRadioSourceField::Get(data));
+    });
+    ForEachPayload<CanRadioTunerPacket>([](const uint8_t* data, const CanRadioTunerPacket& packet) {
+        CHECK_EQUAL(packet.data.Band.band, CanRadioTunerBandField::Get(data));
+        CHECK_EQUAL(packet.data.Frequency1, CanRadioTunerFrequency1Field::Get(data));
+        CHECK_EQUAL(packet.data.Frequency2, CanRadioTunerFrequency2Field::Get(data));
+    });
+    ForEachPayload<VanParkingAidDiagDistancePacket>([](const uint8_t* data, const VanParkingAidDiagDistancePacket& packet) {
+        CHECK_EQUAL(packet.data.DiagFunctionId, VanParkingAidDiagDistanceSignals::GetDiagFunctionId(data));
+        CHECK_EQUAL(packet.data.ExteriorRearLeftDistanceInCm, VanParkingAidDiagDistanceSignals::GetExteriorRearLeftDistanceInCm(data));
+        CHECK_EQUAL(packet.data.InteriorRearRightDistanceInCm, VanParkingAidDiagDistanceSignals::GetInteriorRearRightDistanceInCm(data));
+    });
+    ForEachPayload<CanDisplayPacket>([](const uint8_t* data, const CanDisplayPacket& packet) {
+        CHECK_EQUAL(packet.data.ShowPopup, CanDisplayPopupSignals::GetCategory(data));
+        CHECK_EQUAL(packet.data.Field2.show_popup, CanDisplayPopupSignals::GetShowPopup(data));
+        CHECK_EQUAL(packet.data.DoorStatus1.asByte, CanDisplayPopupSignals::GetDoorStatus1(data));
+        CHECK_EQUAL(packet.data.KmDividedBy256 * 256 + packet.data.KmRemainderUpTo255, CanDisplayPopupSignals::GetKm(data));
+    });
+}
+
+/* Set changes only its own bits, the struct sees the written value */
+static void TestSet()
+{
+    for (uint8_t source = 0; source < 8; source++)
+    {
+        uint8_t data[sizeof(CanRadioPacket)];
+        memset(data, 0xA5, sizeof(data));
+        CanRadioSourceField::Set(data, source);
+
+        const CanRadioPacket packet = DeSerialize<CanRadioPacket>(data);
+        CHECK_EQUAL(source, packet.data.Source.source);
+        CHECK_EQUAL(0xA5 & 0x8F, data[2] & 0x8F);
+        CHECK_EQUAL(0xA5, data[0]);
+        CHECK_EQUAL(0xA5, data[1]);
+        CHECK_EQUAL(0xA5, data[3]);
+    }
+
+    uint8_t data[sizeof(CanRadioPacket)] = { 0 };
+    CanRadioEnabledField::Set(data, 1);
+    CHECK_EQUAL(1, DeSerialize<CanRadioPacket>(data).data.Field1.radio_enabled);
+    CHECK_EQUAL(0x80, data[0]);
+
+    // a value wider than the field is cut to the width
+    CanRadioSourceField::Set(data, 0xFF);
+    CHECK_EQUAL(0x70, data[2]);
+}
+
+static void TestIsInside()
+{
+    CHECK(CanRadioTunerFrequency2Field::IsInside(sizeof(CanRadioTunerPacket)));
+    CHECK(!CanRadioTunerFrequency2Field::IsInside(sizeof(CanRadioTunerPacket) - 1));
+    CHECK(CanMenuEscButtonField::IsInside(3));
+    CHECK(!CanMenuEscButtonField::IsInside(2));
+}
+
+/* Reads MESSAGE_COUNT random payloads both ways, prints the time per message */
+template <class Packet, class ReadStruct, class ReadFields>
+static void Benchmark(const char* name, ReadStruct readStruct, ReadFields readFields)
+{
+    const size_t MESSAGE_COUNT = 1000000;
+    uint8_t messages[64][sizeof(Packet)];
+    for (size_t message = 0; message < 64; message++)
+    {
+        for (size_t i = 0; i < sizeof(Packet); i++)
+        {
+            messages[message][i] = (uint8_t)rand();
+        }
+    }
+    uint32_t checksum = 0;
+
+    const auto structStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < MESSAGE_COUNT; i++)
+    {
+        checksum += readStruct(DeSerialize<Packet>(messages[i & 63]));
+    }
+    const auto structEnd = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < MESSAGE_COUNT; i++)
+    {
+        checksum += readFields(messages[i & 63]);
+    }
+    const auto fieldEnd = std::chrono::steady_clock::now();
+
+    const double structTime = std::chrono::duration<double, std::nano>(structEnd - structStart).count() / MESSAGE_COUNT;
+    const double fieldTime = std::chrono::duration<double, std::nano>(fieldEnd - structEnd).count() / MESSAGE_COUNT;
+    printf("ns per %s message: struct copy %.2f, bit fields %.2f (%u)\n", name, structTime, fieldTime, (unsigned)(checksum & 1));
+}
+
+static void Benchmarks()
+{
+    Benchmark<CanRadioTunerPacket>("tuner",
+        [](const CanRadioTunerPacket& packet) -> uint32_t {
+            return packet.data.Band.band + packet.data.Frequency1 + packet.data.Frequency2;
+        },
+        [](const uint8_t* data) -> uint32_t {
+            return CanRadioTunerBandField::Get(data) + CanRadioTunerFrequency1Field::Get(data) + CanRadioTunerFrequency2Field::Get(data);
+        });
+
+    // the four distances the handler publishes on every answer while reversing
+    Benchmark<VanParkingAidDiagDistancePacket>("parking aid distance",
+        [](const VanParkingAidDiagDistancePacket& packet) -> uint32_t {
+            return packet.data.DiagFunctionId +
+                packet.data.ExteriorRearLeftDistanceInCm + packet.data.ExteriorRearRightDistanceInCm +
+                packet.data.InteriorRearLeftDistanceInCm + packet.data.InteriorRearRightDistanceInCm;
+        },
+        [](const uint8_t* data) -> uint32_t {
+            return VanParkingAidDiagDistanceSignals::GetDiagFunctionId(data) +
+                VanParkingAidDiagDistanceSignals::GetExteriorRearLeftDistanceInCm(data) + VanParkingAidDiagDistanceSignals::GetExteriorRearRightDistanceInCm(data) +
+                VanParkingAidDiagDistanceSignals::GetInteriorRearLeftDistanceInCm(data) + VanParkingAidDiagDistanceSignals::GetInteriorRearRightDistanceInCm(data);
+        });
+
+    Benchmark<CanDisplayPacket>("display popup",
+        [](const CanDisplayPacket& packet) -> uint32_t {
+            return packet.data.ShowPopup + packet.data.PopupMessageType + packet.data.Field2.show_popup +
+                packet.data.DoorStatus1.asByte + packet.data.KmDividedBy256 * 256 + packet.data.KmRemainderUpTo255;
+        },
+        [](const uint8_t* data) -> uint32_t {
+            return CanDisplayPopupSignals::GetCategory(data) + CanDisplayPopupSignals::GetMessageType(data) + CanDisplayPopupSignals::GetShowPopup(data) +
+                CanDisplayPopupSignals::GetDoorStatus1(data) + CanDisplayPopupSignals::GetKm(data);
+        });
+}
+
+int main()
+{
+    // defined in the header for the menu handling, not used here
+    (void)CONST_CAN_RADIO_MENUBUTTONS;
+
+    srand(10);
+    TestGet();
+    TestSet();
+    TestIsInside();
+    Benchmarks();
+    return TestResult();
+}
@@ -0,0 +1,171 @@
+// BridgeEventQueueTest.cpp
+// The event queue from the VAN tasks to the CAN data task: events come out in the order they were pushed, a full queue
+// drops and counts the new event, and events pushed by several tasks at once are neither lost nor duplicated.
+
+#include <atomic>
+#include <thread>
+
+#include "TestCheck.h"
+#include "Helpers/BridgeEventQueue.h"
+
+const static uint32_t QUEUE_LENGTH = 32;
+
+/* The popup fields have room for a producer id and a 24 bit counter */
+static BridgeEvent MakeEvent(uint8_t producer, uint32_t counter)
+{
+    BridgeEvent event = BridgeEvent();
+    event.Type = BRIDGE_EVENT_POPUP_RAISED;
+    event.Popup.Category = producer;
+    event.Popup.MessageType = 0;
+    event.Popup.DoorStatus1 = (uint8_t)(counter >> 16);
+    event.Popup.DoorStatus2 = (uint8_t)(counter >> 8);
+    event.Popup.VANByte = (uint8_t)counter;
+    return event;
+}
+
+static uint32_t GetCounter(const BridgeEvent& event)
+{
+    return (uint32_t)event.Popup.DoorStatus1 << 16 | (uint32_t)event.Popup.DoorStatus2 << 8 | event.Popup.VANByte;
+}
+
+static void TestEmpty()
+{
+    BridgeEventQueue queue;
+    BridgeEvent event = BridgeEvent();
+    CHECK(!queue.Pop(event));
+    CHECK_EQUAL(0, queue.GetDroppedCount());
+}
+
+/* The positions go round the slots many times, the order is kept */
+static void TestWrapAround()
+{
+    BridgeEventQueue queue;
+    uint32_t pushed = 0;
+    uint32_t popped = 0;
+
+    for (int round = 0; round < 1000; round++)
+    {
+        const int pushCount = 1 + round % 7;
+        for (int i = 0; i < pushCount; i++)
+        {
+            CHECK(queue.Push(MakeEvent(0, pushed++)));
+        }
+        BridgeEvent event = BridgeEvent();
+        for (int i = 0; i < pushCount; i++)
+        {
+            CHECK(queue.Pop(event));
+            CHECK_EQUAL(popped++, GetCounter(event));
+        }
+        CHECK(!queue.Pop(event));
+    }
+    CHECK_EQUAL(0, queue.GetDroppedCount());
+}
+
+static void TestFull()
+{
+    BridgeEventQueue queue;
+    for (uint32_t i = 0; i < QUEUE_LENGTH; i++)
+    {
+        CHECK(queue.Push(MakeEvent(0, i)));
+    }
+
+    CHECK(!queue.Push(MakeEvent(0, 100)));
+    CHECK(!queue.Push(BRIDGE_EVENT_TRIP_BUTTON_PRESSED));
+    CHECK_EQUAL(2, queue.GetDroppedCount());
+
+    // a freed slot takes the next event, the dropped ones are not in the queue
+    BridgeEvent event = BridgeEvent();
+    CHECK(queue.Pop(event));
+    CHECK_EQUAL(0, GetCounter(event));
+    CHECK(queue.Push(MakeEvent(0, QUEUE_LENGTH)));
+    CHECK(!queue.Push(MakeEvent(0, 101)));
+    CHECK_EQUAL(3, queue.GetDroppedCount());
+
+    for (uint32_t i = 1; i <= QUEUE_LENGTH; i++)
+    {
+        CHECK(queue.Pop(event));
+        CHECK_EQUAL(i, GetCounter(event));
+    }
+    CHECK(!queue.Pop(event));
+}
+
+/* Three producers (the VAN receive task, the CAN reader and the ignition task) and the CAN data task */
+static void TestConcurrentProducers()
+{
+    const int PRODUCER_COUNT = 3;
+    const uint32_t EVENT_COUNT = 300000;
+
+    BridgeEventQueue queue;
+    std::atomic<int> runningProducers(PRODUCER_COUNT);
+    // a dropped event is pushed again, so every event gets through and the drops are counted on both sides
+    uint32_t droppedCounts[PRODUCER_COUNT] = { 0 };
+
+    std::thread producers[PRODUCER_COUNT];
+    for (int producer = 0; producer < PRODUCER_COUNT; producer++)
+    {
+        producers[producer] = std::thread([&, producer]() {
+            for (uint32_t i = 0; i < EVENT_COUNT; i++)
+            {
+                while (!queue.Push(MakeEvent(producer, i)))
+                {
+                    droppedCounts[producer]++;
+                    std::this_thread::yield();
+                }
+            }
+            runningProducers--;
+        });
+    }
+
+    uint32_t poppedCounts[PRODUCER_COUNT] = { 0 };
+    int64_t previousCounters[PRODUCER_COUNT] = { -1, -1, -1 };
+    uint32_t outOfOrderCount = 0;
+    BridgeEvent event = BridgeEvent();
+    for (;;)
+    {
+        // checked before popping, so the events pushed last are popped as well
+        const bool producersDone = runningProducers.load() == 0;
+        bool poppedAny = false;
+        while (queue.Pop(event))
+        {
+            poppedAny = true;
+            const uint8_t producer = event.Popup.Category;
+            const uint32_t counter = GetCounter(event);
+            if (producer >= PRODUCER_COUNT || (int64_t)counter != previousCounters[producer] + 1)
+            {
+                outOfOrderCount++;
+                continue;
+            }
+            previousCounters[producer] = counter;
+            poppedCounts[producer]++;
+        }
+        if (producersDone && !poppedAny)
+        {
+            break;
+        }
+        if (!poppedAny)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    uint32_t dropped = 0;
+    for (int producer = 0; producer < PRODUCER_COUNT; producer++)
+    {
+        producers[producer].join();
+        CHECK_EQUAL(EVENT_COUNT, poppedCounts[producer]);
+        dropped += droppedCounts[producer];
+    }
+    CHECK_EQUAL(0, outOfOrderCount);
+    CHECK_EQUAL(dropped, queue.GetDroppedCount());
+    CHECK(dropped > 0);
+    printf("events: %u, dropped and pushed again: %u\n", (unsigned)(PRODUCER_COUNT * EVENT_COUNT), (unsigned)dropped);
+}
+
+int main()
+{
+    TestEmpty();
+    TestWrapAround();
+    TestFull();
+    TestConcurrentProducers();
+    return TestResult();
+}
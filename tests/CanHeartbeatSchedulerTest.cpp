@@ -0,0 +1,349 @@
+// CanHeartbeatSchedulerTest.cpp
+// The heartbeats of the CAN handlers sent by the scheduler, driven with a virtual clock: the handlers are spread by their
+// phase offsets, a task woken at the next deadline sends every heartbeat on time, the period keeps its phase however
+// late the lane is processed, missed periods are skipped and counted, a change is sent early but not more often than allowed.
+
+#include <limits.h>
+#include <vector>
+
+#include "TestCheck.h"
+#include "Can/CanHeartbeatScheduler.h"
+
+class FakeCanMessageSender : public AbstractCanMessageSender {
+public:
+    std::vector<uint16_t> SentIds;
+    std::vector<unsigned long> SendTimes;
+    unsigned long CurrentTime = 0;
+
+    void Init() override
+    {
+    }
+
+    uint8_t SendMessage(uint16_t canId, uint8_t ext, uint8_t sizeOfByteArray, uint8_t *byteArray) override
+    {
+        (void)ext; (void)sizeOfByteArray; (void)byteArray;
+        SentIds.push_back(canId);
+        SendTimes.push_back(CurrentTime);
+        return CAN_SEND_OK;
+    }
+
+    void ReadMessage(uint16_t* canId, uint8_t* len, uint8_t* buf) override
+    {
+        (void)canId; (void)len; (void)buf;
+    }
+
+    std::vector<unsigned long> GetSendTimes(uint16_t canId)
+    {
+        std::vector<unsigned long> times;
+        for (size_t i = 0; i < SentIds.size(); i++)
+        {
+            if (SentIds[i] == canId)
+            {
+                times.push_back(SendTimes[i]);
+            }
+        }
+        return times;
+    }
+};
+
+class TestHandler : public CanMessageHandlerBase {
+    uint8_t payload[1] = { 0 };
+
+    void InternalProcess() override
+    {
+        canMessageSender->SendMessage(canId, 0, sizeof(payload), payload);
+    }
+
+public:
+    TestHandler(AbstractCanMessageSender* sender, uint16_t id, uint16_t interval, uint16_t minInterval = 0)
+        : CanMessageHandlerBase(sender, id, interval, minInterval)
+    {
+    }
+
+    void Change()
+    {
+        SetDataChanged();
+    }
+};
+
+/* One cycle of the task feeding the handlers: Process() on each handler, then the due heartbeats of the lane */
+static void Run(CanHeartbeatScheduler& scheduler, std::vector<TestHandler*> handlers, FakeCanMessageSender& sender, unsigned long time)
+{
+    sender.CurrentTime = time;
+    for (size_t i = 0; i < handlers.size(); i++)
+    {
+        handlers[i]->Process(time);
+    }
+    scheduler.Process(0, time);
+}
+
+static void TestPhaseOffsets()
+{
+    FakeCanMessageSender sender;
+    TestHandler first(&sender, 0x101, 40);
+    TestHandler second(&sender, 0x102, 40);
+    TestHandler third(&sender, 0x103, 40);
+    TestHandler fast(&sender, 0x104, 20);
+
+    CanHeartbeatScheduler scheduler;
+    scheduler.Register(&first, 0);
+    scheduler.Register(&second, 0);
+    scheduler.Register(&third, 0);
+    scheduler.Register(&fast, 0);
+
+    CHECK_EQUAL(0, scheduler.GetHeartbeat(&first)->PhaseOffset);
+    CHECK_EQUAL(10, scheduler.GetHeartbeat(&second)->PhaseOffset);
+    CHECK_EQUAL(20, scheduler.GetHeartbeat(&third)->PhaseOffset);
+    // the offset is shorter than the period
+    CHECK_EQUAL(10, scheduler.GetHeartbeat(&fast)->PhaseOffset);
+
+    for (unsigned long time = 1000; time < 2000; time += 5)
+    {
+        Run(scheduler, { &first, &second, &third, &fast }, sender, time);
+    }
+
+    const std::vector<unsigned long> secondTimes = sender.GetSendTimes(0x102);
+    CHECK_EQUAL(25, secondTimes.size());
+    for (size_t i = 0; i < secondTimes.size(); i++)
+    {
+        CHECK_EQUAL(1010 + i * 40, secondTimes[i]);
+    }
+
+    const std::vector<unsigned long> fastTimes = sender.GetSendTimes(0x104);
+    CHECK_EQUAL(50, fastTimes.size());
+    CHECK_EQUAL(1010, fastTimes[0]);
+    CHECK_EQUAL(1030, fastTimes[1]);
+
+    CHECK_EQUAL(25, first.GetSentCount());
+    CHECK_EQUAL(0, scheduler.GetHeartbeat(&third)->MissedCount);
+    CHECK_EQUAL(0, scheduler.GetHeartbeat(&third)->MaxLateness);
+}
+
+/* A task sleeping until GetNextDeadline() sends every heartbeat exactly at its deadline, in the order of the deadlines */
+static void TestWakeAtDeadlines()
+{
+    FakeCanMessageSender sender;
+    TestHandler speed(&sender, 0x0B6, 40);
+    TestHandler dash3(&sender, 0x128, 80);
+    TestHandler dash4(&sender, 0x161, 100);
+    TestHandler radio(&sender, 0x0A2, 500);
+    TestHandler parking(&sender, 0x0E1, 10);
+    const std::vector<TestHandler*> handlers = { &speed, &dash3, &dash4, &radio, &parking };
+
+    CanHeartbeatScheduler scheduler;
+    for (size_t i = 0; i < handlers.size(); i++)
+    {
+        scheduler.Register(handlers[i], 0);
+    }
+
+    Run(scheduler, handlers, sender, 0);
+    unsigned long deadline = 0;
+    while (scheduler.GetNextDeadline(0, deadline) && deadline < 2000)
+    {
+        Run(scheduler, handlers, sender, deadline);
+    }
+
+    for (size_t i = 1; i < sender.SendTimes.size(); i++)
+    {
+        CHECK(sender.SendTimes[i] >= sender.SendTimes[i - 1]);
+    }
+
+    for (size_t i = 0; i < handlers.size(); i++)
+    {
+        const CanHeartbeat* heartbeat = scheduler.GetHeartbeat(handlers[i]);
+        const uint16_t period = handlers[i]->GetProcessInterval();
+
+        CHECK_EQUAL((2000 - heartbeat->PhaseOffset + period - 1) / period, heartbeat->SentCount);
+        CHECK_EQUAL(0, heartbeat->MaxLateness);
+        CHECK_EQUAL(0, heartbeat->MaxJitter);
+
+        const std::vector<unsigned long> times = sender.GetSendTimes(handlers[i]->GetCanId());
+        for (size_t j = 0; j < times.size(); j++)
+        {
+            CHECK_EQUAL(heartbeat->PhaseOffset + j * period, times[j]);
+        }
+    }
+}
+
+/* Processed every 7 ms, the sends are up to one call late but stay on the 40 ms grid */
+static void TestNoDrift()
+{
+    FakeCanMessageSender sender;
+    TestHandler handler(&sender, 0x123, 40);
+    CanHeartbeatScheduler scheduler;
+    scheduler.Register(&handler, 0);
+
+    for (unsigned long time = 0; time < 40000; time += 7)
+    {
+        Run(scheduler, { &handler }, sender, time);
+    }
+
+    CHECK_EQUAL(1000, sender.SendTimes.size());
+    for (size_t i = 0; i < sender.SendTimes.size(); i++)
+    {
+        const unsigned long deadline = i * 40;
+        CHECK(sender.SendTimes[i] >= deadline);
+        CHECK(sender.SendTimes[i] - deadline < 7);
+    }
+
+    const CanHeartbeat* heartbeat = scheduler.GetHeartbeat(&handler);
+    CHECK_EQUAL(0, heartbeat->MissedCount);
+    CHECK(heartbeat->MaxLateness < 7);
+    CHECK(heartbeat->MaxJitter < 7);
+}
+
+static void TestMissedPeriods()
+{
+    FakeCanMessageSender sender;
+    TestHandler handler(&sender, 0x123, 40);
+    CanHeartbeatScheduler scheduler;
+    scheduler.Register(&handler, 0);
+
+    Run(scheduler, { &handler }, sender, 0);
+    // the deadlines at 40, 80 and 120 are missed, one message is sent for them
+    Run(scheduler, { &handler }, sender, 130);
+    Run(scheduler, { &handler }, sender, 150);
+    Run(scheduler, { &handler }, sender, 160);
+
+    CHECK_EQUAL(3, sender.SendTimes.size());
+    CHECK_EQUAL(0, sender.SendTimes[0]);
+    CHECK_EQUAL(130, sender.SendTimes[1]);
+    CHECK_EQUAL(160, sender.SendTimes[2]);
+
+    const CanHeartbeat* heartbeat = scheduler.GetHeartbeat(&handler);
+    CHECK_EQUAL(1, heartbeat->MissedCount);
+    CHECK_EQUAL(90, heartbeat->MaxLateness);
+    CHECK_EQUAL(90, heartbeat->LatenessSum);
+    CHECK_EQUAL(90, heartbeat->MaxJitter);
+}
+
+/* millis() wraps around after 49 days */
+static void TestWraparound()
+{
+    FakeCanMessageSender sender;
+    TestHandler handler(&sender, 0x123, 40);
+    CanHeartbeatScheduler scheduler;
+    scheduler.Register(&handler, 0);
+
+    const unsigned long start = ULONG_MAX - 95;
+    for (unsigned long i = 0; i < 40; i++)
+    {
+        Run(scheduler, { &handler }, sender, start + i * 10);
+    }
+
+    CHECK_EQUAL(10, sender.SendTimes.size());
+    for (size_t i = 0; i < sender.SendTimes.size(); i++)
+    {
+        CHECK_EQUAL(start + i * 40, sender.SendTimes[i]);
+    }
+    CHECK_EQUAL(0, scheduler.GetHeartbeat(&handler)->MissedCount);
+    CHECK_EQUAL(0, scheduler.GetHeartbeat(&handler)->MaxLateness);
+}
+
+static void TestSendOnChange()
+{
+    FakeCanMessageSender sender;
+    TestHandler handler(&sender, 0x123, 1000, 50);
+    CanHeartbeatScheduler scheduler;
+    scheduler.Register(&handler, 0);
+
+    Run(scheduler, { &handler }, sender, 0);
+    handler.Change();
+    Run(scheduler, { &handler }, sender, 10);
+    Run(scheduler, { &handler }, sender, 50);
+    Run(scheduler, { &handler }, sender, 60);
+    handler.Change();
+    Run(scheduler, { &handler }, sender, 70);
+    Run(scheduler, { &handler }, sender, 100);
+    Run(scheduler, { &handler }, sender, 200);
+
+    CHECK_EQUAL(3, sender.SendTimes.size());
+    CHECK_EQUAL(0, sender.SendTimes[0]);
+    CHECK_EQUAL(50, sender.SendTimes[1]);
+    CHECK_EQUAL(100, sender.SendTimes[2]);
+
+    // the heartbeat keeps its own deadline
+    Run(scheduler, { &handler }, sender, 1000);
+    CHECK_EQUAL(4, sender.SendTimes.size());
+    CHECK_EQUAL(1000, sender.SendTimes[3]);
+    CHECK_EQUAL(2, scheduler.GetHeartbeat(&handler)->SentCount);
+    CHECK_EQUAL(4, handler.GetSentCount());
+
+    // without a minimum interval a change waits for the heartbeat
+    FakeCanMessageSender heartbeatSender;
+    TestHandler heartbeatHandler(&heartbeatSender, 0x123, 1000);
+    CanHeartbeatScheduler heartbeatScheduler;
+    heartbeatScheduler.Register(&heartbeatHandler, 0);
+    Run(heartbeatScheduler, { &heartbeatHandler }, heartbeatSender, 0);
+    heartbeatHandler.Change();
+    Run(heartbeatScheduler, { &heartbeatHandler }, heartbeatSender, 500);
+    CHECK_EQUAL(1, heartbeatSender.SendTimes.size());
+}
+
+/* The parking aid is only processed in reverse, its heartbeats stop when it is not */
+static void TestInactiveHandler()
+{
+    FakeCanMessageSender sender;
+    TestHandler always(&sender, 0x101, 40);
+    TestHandler parking(&sender, 0x0E1, 10);
+    CanHeartbeatScheduler scheduler;
+    scheduler.Register(&always, 0);
+    scheduler.Register(&parking, 0);
+
+    for (unsigned long time = 0; time < 1000; time += 10)
+    {
+        Run(scheduler, { &always }, sender, time);
+    }
+    CHECK_EQUAL(0, sender.GetSendTimes(0x0E1).size());
+    CHECK_EQUAL(25, sender.GetSendTimes(0x101).size());
+
+    for (unsigned long time = 1000; time < 1100; time += 10)
+    {
+        Run(scheduler, { &always, &parking }, sender, time);
+    }
+    // the deadlines kept their phase while the handler was not processed
+    const std::vector<unsigned long> parkingTimes = sender.GetSendTimes(0x0E1);
+    CHECK_EQUAL(10, parkingTimes.size());
+    CHECK_EQUAL(1000, parkingTimes[0]);
+    CHECK_EQUAL(0, scheduler.GetHeartbeat(&parking)->MissedCount);
+}
+
+/* A lane only sends its own heartbeats, the other task sends the rest */
+static void TestLanes()
+{
+    FakeCanMessageSender sender;
+    TestHandler data(&sender, 0x101, 40);
+    TestHandler ignition(&sender, 0x0E1, 10);
+    CanHeartbeatScheduler scheduler;
+    scheduler.Register(&data, 0);
+    scheduler.Register(&ignition, 1);
+
+    unsigned long deadline = 0;
+    CHECK(!scheduler.GetNextDeadline(1, deadline));
+
+    data.Process(0);
+    ignition.Process(0);
+    scheduler.Process(0, 0);
+    CHECK_EQUAL(1, data.GetSentCount());
+    CHECK_EQUAL(0, ignition.GetSentCount());
+
+    // the lane starts at its first Process(), the offset follows the registration order over all lanes (10 % 10)
+    scheduler.Process(1, 5);
+    CHECK_EQUAL(1, ignition.GetSentCount());
+    CHECK_EQUAL(1, data.GetSentCount());
+    CHECK(scheduler.GetNextDeadline(1, deadline));
+    CHECK_EQUAL(15, deadline);
+}
+
+int main()
+{
+    TestPhaseOffsets();
+    TestWakeAtDeadlines();
+    TestNoDrift();
+    TestMissedPeriods();
+    TestWraparound();
+    TestSendOnChange();
+    TestInactiveHandler();
+    TestLanes();
+    return TestResult();
+}
@@ -0,0 +1,117 @@
+// HeapAllocationTest.cpp
+// Sending a CAN frame must not touch the heap: the senders run dozens of times per second from tasks on both cores and
+// share the FreeRTOS heap. Every allocation of the process is counted by replacing the global operator new.
+
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arduino.h"
+#include "TestCheck.h"
+#include "Can/Structs/CanRadioStructs.h"
+#include "Can/Structs/CanRadioTunerStructs.h"
+#include "Can/Structs/CanMenuStructs.h"
+#include "Can/Structs/CanIgnitionStructs.h"
+#include "Can/Structs/CanDash1Structs.h"
+#include "Can/Structs/CanTrip0Structs.h"
+#include "Can/Structs/CanSpeedAndRpmStructs.h"
+
+static size_t allocationCount = 0;
+
+void* operator new(size_t size)
+{
+    allocationCount++;
+    void* memory = malloc(size == 0 ? 1 : size);
+    if (memory == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    free(memory);
+}
+
+/* Keeps the last frame, as the transmit queue copies it into its own slot */
+class FakeCanMessageSender : public AbstractCanMessageSender {
+public:
+    uint8_t LastFrame[8];
+    uint32_t FrameCount = 0;
+
+    void Init() override
+    {
+    }
+
+    uint8_t SendMessage(uint16_t canId, uint8_t ext, uint8_t sizeOfByteArray, uint8_t *byteArray) override
+    {
+        (void)canId; (void)ext;
+        memcpy(LastFrame, byteArray, sizeOfByteArray > sizeof(LastFrame) ? sizeof(LastFrame) : sizeOfByteArray);
+        FrameCount++;
+        return CAN_SEND_OK;
+    }
+
+    void ReadMessage(uint16_t* canId, uint8_t* len, uint8_t* buf) override
+    {
+        (void)canId; (void)len; (void)buf;
+    }
+};
+
+/* The counter has to see an allocation, otherwise the test below proves nothing */
+static void TestCounterWorks()
+{
+    const size_t countBefore = allocationCount;
+    uint8_t* volatile buffer = new uint8_t[16];
+    delete[] buffer;
+    CHECK_EQUAL(countBefore + 1, allocationCount);
+}
+
+static void TestSendersDoNotAllocate()
+{
+    const uint32_t ROUND_COUNT = 1000;
+    FakeCanMessageSender canSender;
+
+    CanRadioPacketSender radioSender(&canSender);
+    CanRadioTunerMessageSender tunerSender(&canSender);
+    CanRadioButtonPacketSender buttonSender(&canSender);
+    CanIgnitionPacketSender ignitionSender(&canSender);
+    CanDashIgnitionPacketSender dashIgnitionSender(&canSender);
+    CanTrip0PacketSender trip0Sender(&canSender);
+    CanSpeedAndRpmPacketSender speedAndRpmSender(&canSender);
+
+    const size_t countBefore = allocationCount;
+    for (uint32_t i = 0; i < ROUND_COUNT; i++)
+    {
+        radioSender.Send(i & 1, CAN_RADIO_SOURCE_TUNER);
+        tunerSender.Send(CAN_RADIO_TUNER_BAND_FM1, 87.5 + (i % 200) * 0.1, 1);
+        buttonSender.SendButtonCode(CONST_OK_BUTTON);
+        ignitionSender.SendIgnition(0, i % 16, 1);
+        dashIgnitionSender.SendIgnition(1, 90, 20, 0x01, 0xE2, 0x40, 0);
+        trip0Sender.SendTripInfo(500, 65, 120, 0);
+        speedAndRpmSender.Send(i % 200, 800 + i, i);
+    }
+
+    CHECK_EQUAL(0, allocationCount - countBefore);
+    CHECK_EQUAL(7 * ROUND_COUNT, canSender.FrameCount);
+}
+
+int main()
+{
+    // defined in the header for the menu handling, not used here
+    (void)CONST_CAN_RADIO_MENUBUTTONS;
+
+    TestCounterWorks();
+    TestSendersDoNotAllocate();
+    return TestResult();
+}
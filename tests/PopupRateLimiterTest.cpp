@@ -0,0 +1,185 @@
+// PopupRateLimiterTest.cpp
+// The popup rate limiter remembers only the recently shown types. Replayed with every popup type the display handler can
+// queue, it has to decide exactly as a timestamp for each of the 256 types would.
+
+#include <stdlib.h>
+
+#include "Arduino.h"
+#include "TestCheck.h"
+#include "Helpers/PopupRateLimiter.h"
+#include "Helpers/VanCanDisplayPopupMap.h"
+
+// as in CanDisplayPopupHandler3
+const static unsigned long CHILL_TIME = 24000;
+const static uint8_t POPUP_TYPE_CAPACITY = CountDistinctLookupValues(VAN_TO_CAN_POPUP_MESSAGE_ENTRIES) + 1;
+
+/* The full table the limiter replaces */
+class ReferenceRateLimiter
+{
+    unsigned long shownTimes[256];
+
+public:
+    ReferenceRateLimiter()
+    {
+        Reset();
+    }
+
+    bool TryShow(uint8_t popupType, unsigned long currentTime)
+    {
+        if (currentTime - shownTimes[popupType] <= CHILL_TIME)
+        {
+            return false;
+        }
+        shownTimes[popupType] = currentTime;
+        return true;
+    }
+
+    bool IsChilling(uint8_t popupType, unsigned long currentTime)
+    {
+        return currentTime - shownTimes[popupType] <= CHILL_TIME;
+    }
+
+    void Reset()
+    {
+        memset(shownTimes, 0, sizeof(shownTimes));
+    }
+};
+
+/* Every type the handler can queue: what the VAN popups are mapped to (0 for the unmapped ones) and the risk of ice */
+static uint8_t CollectPopupTypes(uint8_t popupTypes[256])
+{
+    bool isListed[256] = { false };
+    uint8_t count = 0;
+    for (int vanMessage = 0; vanMessage < 256; vanMessage++)
+    {
+        isListed[VAN_TO_CAN_POPUP_MESSAGE_TABLE.Get(vanMessage)] = true;
+    }
+    isListed[CAN_POPUP_MSG_RISK_OF_ICE] = true;
+
+    for (int popupType = 0; popupType < 256; popupType++)
+    {
+        if (isListed[popupType])
+        {
+            popupTypes[count++] = popupType;
+        }
+    }
+    return count;
+}
+
+static void TestCapacity()
+{
+    uint8_t popupTypes[256];
+    CHECK(CollectPopupTypes(popupTypes) <= POPUP_TYPE_CAPACITY);
+}
+
+static void TestReplay()
+{
+    const uint32_t EVENT_COUNT = 500000;
+
+    uint8_t popupTypes[256];
+    const uint8_t popupTypeCount = CollectPopupTypes(popupTypes);
+
+    PopupRateLimiter<POPUP_TYPE_CAPACITY> limiter(CHILL_TIME);
+    ReferenceRateLimiter reference;
+
+    unsigned long currentTime = 100000;
+    uint32_t shownCount = 0;
+    for (uint32_t i = 0; i < EVENT_COUNT; i++)
+    {
+        // bursts of popups in the same millisecond as well as long quiet periods
+        currentTime += rand() % 4 == 0 ? rand() % 3000 : rand() % 5;
+
+        // the ignition is switched off now and then
+        if (rand() % 20000 == 0)
+        {
+            limiter.Reset();
+            reference.Reset();
+        }
+
+        const uint8_t popupType = popupTypes[rand() % popupTypeCount];
+        const bool expected = reference.TryShow(popupType, currentTime);
+        CHECK_EQUAL(expected, limiter.TryShow(popupType, currentTime));
+        shownCount += expected;
+    }
+
+    // the replay has to exercise both decisions
+    CHECK(shownCount > EVENT_COUNT / 100);
+    CHECK(shownCount < EVENT_COUNT / 2);
+}
+
+/*
+    Few slots for many types, the slots are reused all the time. New types come only while fewer types are in their chill
+    time than there are slots, as in the handler, so forgetting a type must never change a decision.
+*/
+static void TestReplayWithSlotReuse()
+{
+    const uint32_t EVENT_COUNT = 200000;
+    const uint8_t SLOT_COUNT = 4;
+    const uint8_t POPUP_TYPE_COUNT = 16;
+
+    PopupRateLimiter<SLOT_COUNT> limiter(CHILL_TIME);
+    ReferenceRateLimiter reference;
+
+    unsigned long currentTime = 100000;
+    uint32_t shownCount = 0;
+    for (uint32_t i = 0; i < EVENT_COUNT; i++)
+    {
+        currentTime += rand() % 10000;
+
+        uint8_t chillingTypes[POPUP_TYPE_COUNT];
+        uint8_t chillingCount = 0;
+        for (uint8_t popupType = 0; popupType < POPUP_TYPE_COUNT; popupType++)
+        {
+            if (reference.IsChilling(popupType, currentTime))
+            {
+                chillingTypes[chillingCount++] = popupType;
+            }
+        }
+
+        const uint8_t popupType = chillingCount < SLOT_COUNT
+            ? rand() % POPUP_TYPE_COUNT
+            : chillingTypes[rand() % chillingCount];
+        const bool expected = reference.TryShow(popupType, currentTime);
+        CHECK_EQUAL(expected, limiter.TryShow(popupType, currentTime));
+        shownCount += expected;
+    }
+
+    CHECK(shownCount > EVENT_COUNT / 10);
+    CHECK(shownCount < EVENT_COUNT);
+}
+
+/* With fewer slots than types in their chill time the oldest one is forgotten, as documented */
+static void TestTooFewSlots()
+{
+    PopupRateLimiter<2> limiter(CHILL_TIME);
+
+    CHECK(limiter.TryShow(1, 30000));
+    CHECK(limiter.TryShow(2, 31000));
+    CHECK(limiter.TryShow(3, 32000));
+    CHECK(!limiter.TryShow(2, 33000));
+    CHECK(!limiter.TryShow(3, 33000));
+    CHECK(limiter.TryShow(1, 33000));
+}
+
+static void TestExpiredSlotIsReused()
+{
+    PopupRateLimiter<2> limiter(CHILL_TIME);
+
+    CHECK(limiter.TryShow(1, 30000));
+    CHECK(limiter.TryShow(2, 50000));
+    // type 1 is over its chill time, its slot is taken and type 2 is still remembered
+    CHECK(limiter.TryShow(3, 60000));
+    CHECK(!limiter.TryShow(2, 60000));
+    CHECK(!limiter.TryShow(3, 61000));
+}
+
+int main()
+{
+    srand(24);
+    TestCapacity();
+    TestReplay();
+    TestReplayWithSlotReuse();
+    TestTooFewSlots();
+    TestExpiredSlotIsReused();
+    return TestResult();
+}
@@ -0,0 +1,114 @@
+// SharedSnapshotTest.cpp
+// The seqlock between the VAN task and the CAN tasks: a reader must never see a struct half from one write and half from
+// the next one, and it must never see the values going back.
+
+#include <atomic>
+#include <string.h>
+#include <thread>
+
+#include "TestCheck.h"
+#include "Helpers/SharedSnapshot.h"
+
+/* Larger than a cache line, so a torn copy is likely to show up if the sequence checks were wrong */
+struct TestData {
+    uint32_t Values[40];
+};
+
+static TestData MakeData(uint32_t value)
+{
+    TestData data;
+    for (size_t i = 0; i < sizeof(data.Values) / sizeof(data.Values[0]); i++)
+    {
+        data.Values[i] = value;
+    }
+    return data;
+}
+
+static void TestSingleThread()
+{
+    SharedSnapshot<TestData> snapshot;
+    SharedSnapshotView<TestData> view(snapshot);
+
+    CHECK_EQUAL(0, snapshot.GetVersion());
+    CHECK_EQUAL(0, view.Take().Values[0]);
+
+    snapshot.Write(MakeData(7));
+    CHECK_EQUAL(1, snapshot.GetVersion());
+
+    // the view keeps its copy until the next Take()
+    const TestData& taken = view.Take();
+    snapshot.Write(MakeData(8));
+    CHECK_EQUAL(7, taken.Values[0]);
+    CHECK_EQUAL(7, taken.Values[39]);
+    CHECK_EQUAL(8, view.Take().Values[39]);
+    CHECK_EQUAL(2, snapshot.GetVersion());
+}
+
+/* One writer and two readers, as the VAN task and the two CAN tasks */
+static void TestConcurrentReaders()
+{
+    const uint32_t WRITE_COUNT = 1000000;
+    const int READER_COUNT = 2;
+
+    SharedSnapshot<TestData> snapshot;
+    std::atomic<bool> writerDone(false);
+    std::atomic<int> tornCount(0);
+    std::atomic<int> backwardsCount(0);
+    uint32_t readCounts[READER_COUNT] = { 0 };
+
+    std::thread readers[READER_COUNT];
+    for (int reader = 0; reader < READER_COUNT; reader++)
+    {
+        readers[reader] = std::thread([&, reader]() {
+            SharedSnapshotView<TestData> view(snapshot);
+            uint32_t previousValue = 0;
+            bool done = false;
+            while (!done)
+            {
+                // the last read after the writer finished must see the last write
+                done = writerDone.load();
+
+                const TestData& data = view.Take();
+                for (size_t i = 1; i < sizeof(data.Values) / sizeof(data.Values[0]); i++)
+                {
+                    if (data.Values[i] != data.Values[0])
+                    {
+                        tornCount++;
+                        break;
+                    }
+                }
+                if (data.Values[0] < previousValue)
+                {
+                    backwardsCount++;
+                }
+                previousValue = data.Values[0];
+                readCounts[reader]++;
+            }
+            CHECK_EQUAL(WRITE_COUNT, previousValue);
+        });
+    }
+
+    for (uint32_t value = 1; value <= WRITE_COUNT; value++)
+    {
+        snapshot.Write(MakeData(value));
+    }
+    writerDone = true;
+
+    for (int reader = 0; reader < READER_COUNT; reader++)
+    {
+        readers[reader].join();
+        CHECK(readCounts[reader] > 0);
+    }
+
+    CHECK_EQUAL(0, tornCount.load());
+    CHECK_EQUAL(0, backwardsCount.load());
+    CHECK_EQUAL(WRITE_COUNT, snapshot.GetVersion());
+    printf("reads while %u writes: %u, %u\n", (unsigned)WRITE_COUNT, (unsigned)readCounts[0], (unsigned)readCounts[1]);
+}
+
+int main()
+{
+    TestSingleThread();
+    TestConcurrentReaders();
+    return TestResult();
+}
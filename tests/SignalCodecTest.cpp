@@ -0,0 +1,305 @@
+// SignalCodecTest.cpp
+// Golden payloads for the codecs generated from schema/signals.json: decoding them gives the listed values,
+// encoding the values into a zeroed buffer gives the same bytes back.
+
+#include <string.h>
+
+#include "TestCheck.h"
+#include "Van/Generated/VanSignals.h"
+#include "Can/Generated/CanSignals.h"
+
+static void TestVanSpeedAndRpm()
+{
+    // 4000 / 8 rpm, 6000 / 100 km/h, distance counter 0x1234 (little endian), consumption counter 0x55
+    const uint8_t golden[VanSpeedAndRpmSignals::LENGTH] = { 0x0F, 0xA0, 0x17, 0x70, 0x34, 0x12, 0x55 };
+
+    CHECK_EQUAL(500, VanSpeedAndRpmSignals::GetRpm(golden));
+    CHECK_EQUAL(60, VanSpeedAndRpmSignals::GetSpeed(golden));
+    CHECK_EQUAL(0x1234, VanSpeedAndRpmSignals::GetDistance(golden));
+    CHECK_EQUAL(0x55, VanSpeedAndRpmSignals::GetConsumption(golden));
+
+    uint8_t encoded[VanSpeedAndRpmSignals::LENGTH] = { 0 };
+    VanSpeedAndRpmSignals::SetRpm(encoded, 500);
+    VanSpeedAndRpmSignals::SetSpeed(encoded, 60);
+    VanSpeedAndRpmSignals::SetDistance(encoded, 0x1234);
+    VanSpeedAndRpmSignals::SetConsumption(encoded, 0x55);
+    CHECK(memcmp(golden, encoded, sizeof(golden)) == 0);
+
+    // the engine is off: the BSI sends all ones
+    const uint8_t invalid[VanSpeedAndRpmSignals::LENGTH] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00 };
+    CHECK_EQUAL(0, VanSpeedAndRpmSignals::GetRpm(invalid));
+    CHECK_EQUAL(0, VanSpeedAndRpmSignals::GetSpeed(invalid));
+    CHECK_EQUAL(0xFFFF, VanSpeedAndRpmSignals::GetRpmRaw(invalid));
+}
+
+static void TestVanDashboard()
+{
+    // brightness 12 with the heartbeat and backlight off bits, ignition + engine running + reverse,
+    // water 90 - 40 C, mileage 123456, outside (70 - 80) / 2 C
+    const uint8_t golden[VanDashboardSignals::LENGTH] = { 0x9C, 0x26, 0x5A, 0x01, 0xE2, 0x40, 0x46 };
+
+    CHECK_EQUAL(12, VanDashboardSignals::GetBrightness(golden));
+    CHECK_EQUAL(1, VanDashboardSignals::GetHeartbeat(golden));
+    CHECK_EQUAL(1, VanDashboardSignals::GetIsBacklightOff(golden));
+    CHECK_EQUAL(0, VanDashboardSignals::GetAccessoriesOn(golden));
+    CHECK_EQUAL(1, VanDashboardSignals::GetIgnitionOn(golden));
+    CHECK_EQUAL(1, VanDashboardSignals::GetEngineRunning(golden));
+    CHECK_EQUAL(0, VanDashboardSignals::GetDoorOpen(golden));
+    CHECK_EQUAL(0, VanDashboardSignals::GetEconomyMode(golden));
+    CHECK_EQUAL(1, VanDashboardSignals::GetReverseGear(golden));
+    CHECK_EQUAL(0, VanDashboardSignals::GetTrailerPresent(golden));
+    CHECK_EQUAL(50, VanDashboardSignals::GetWaterTemperature(golden));
+    CHECK_EQUAL(123456, VanDashboardSignals::GetMileage(golden));
+    CHECK_EQUAL(-5, VanDashboardSignals::GetExternalTemperature(golden));
+
+    uint8_t encoded[VanDashboardSignals::LENGTH] = { 0 };
+    VanDashboardSignals::SetBrightness(encoded, 12);
+    VanDashboardSignals::SetHeartbeat(encoded, 1);
+    VanDashboardSignals::SetIsBacklightOff(encoded, 1);
+    VanDashboardSignals::SetIgnitionOn(encoded, 1);
+    VanDashboardSignals::SetEngineRunning(encoded, 1);
+    VanDashboardSignals::SetReverseGear(encoded, 1);
+    VanDashboardSignals::SetWaterTemperature(encoded, 50);
+    VanDashboardSignals::SetMileage(encoded, 123456);
+    VanDashboardSignals::SetExternalTemperature(encoded, -5);
+    CHECK(memcmp(golden, encoded, sizeof(golden)) == 0);
+
+    // setting a bit leaves its neighbours alone
+    VanDashboardSignals::SetReverseGear(encoded, 0);
+    CHECK_EQUAL(0x06, encoded[1]);
+    VanDashboardSignals::SetBrightness(encoded, 0);
+    CHECK_EQUAL(0x90, encoded[0]);
+}
+
+static void TestCanSpeedAndRpm()
+{
+    const uint8_t golden[CanSpeedAndRpmSignals::LENGTH] = { 0x0F, 0xA0, 0x17, 0x70, 0x34, 0x12, 0x55, 0xD0 };
+
+    uint8_t encoded[CanSpeedAndRpmSignals::LENGTH] = { 0 };
+    CanSpeedAndRpmSignals::SetRpm(encoded, 500);
+    CanSpeedAndRpmSignals::SetSpeed(encoded, 60);
+    CanSpeedAndRpmSignals::SetOdometer(encoded, 0x1234);
+    CanSpeedAndRpmSignals::SetFuelConsumptionCounter(encoded, 0x55);
+    CanSpeedAndRpmSignals::SetField4(encoded, 0xD0);
+    CHECK(memcmp(golden, encoded, sizeof(golden)) == 0);
+
+    CHECK_EQUAL(500, CanSpeedAndRpmSignals::GetRpm(golden));
+    CHECK_EQUAL(60, CanSpeedAndRpmSignals::GetSpeed(golden));
+    CHECK_EQUAL(0x1234, CanSpeedAndRpmSignals::GetOdometer(golden));
+    CHECK_EQUAL(0x55, CanSpeedAndRpmSignals::GetFuelConsumptionCounter(golden));
+    CHECK_EQUAL(0xD0, CanSpeedAndRpmSignals::GetField4(golden));
+}
+
+static void TestCanTrip0()
+{
+    // trip switch pressed and consumption unknown, 6.5 l/100km, 420 km to the gas station, 123.4 km to the finish
+    const uint8_t golden[CanTrip0Signals::LENGTH] = { 0x88, 0x00, 0x41, 0x01, 0xA4, 0x04, 0xD2 };
+
+    uint8_t encoded[CanTrip0Signals::LENGTH] = { 0 };
+    CanTrip0Signals::SetTripSwitchPressed(encoded, 1);
+    CanTrip0Signals::SetLitersPer100KmIsNull(encoded, 1);
+    CanTrip0Signals::SetLitersPer100Km(encoded, 65);
+    CanTrip0Signals::SetKmToGasStation(encoded, 420);
+    CanTrip0Signals::SetKmToFinish(encoded, 123);
+    CHECK_EQUAL(0x88, encoded[0]);
+    CHECK_EQUAL(0x00, encoded[1]);
+    CHECK_EQUAL(0x41, encoded[2]);
+    CHECK_EQUAL(0x01, encoded[3]);
+    CHECK_EQUAL(0xA4, encoded[4]);
+    // 123 * 10
+    CHECK_EQUAL(0x04, encoded[5]);
+    CHECK_EQUAL(0xCE, encoded[6]);
+
+    CHECK_EQUAL(1, CanTrip0Signals::GetTripSwitchPressed(golden));
+    CHECK_EQUAL(0, CanTrip0Signals::GetRestOfRunIsNull(golden));
+    CHECK_EQUAL(1, CanTrip0Signals::GetLitersPer100KmIsNull(golden));
+    CHECK_EQUAL(65, CanTrip0Signals::GetLitersPer100Km(golden));
+    CHECK_EQUAL(420, CanTrip0Signals::GetKmToGasStation(golden));
+    CHECK_EQUAL(123, CanTrip0Signals::GetKmToFinish(golden));
+}
+
+static void TestVanCarStatus()
+{
+    // front left door and boot open, trip button pressed, trip 1: 56 km/h, 1234 km, 6.5 l/100km,
+    // trip 2: 0x4321 km, 0x0102 l/100km, current consumption 7.2 l/100km, 380 km left to the pump
+    const uint8_t golden[VanCarStatusSignals::LENGTH] = {
+        0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00,
+        0x04, 0xD2, 0x00, 0x41, 0x43, 0x21, 0x01, 0x02, 0x00, 0x48, 0x01, 0x7C, 0x8E };
+
+    CHECK_EQUAL(1, VanCarStatusSignals::GetFrontLeftDoorOpen(golden));
+    CHECK_EQUAL(0, VanCarStatusSignals::GetFrontRightDoorOpen(golden));
+    CHECK_EQUAL(1, VanCarStatusSignals::GetBootLidOpen(golden));
+    CHECK_EQUAL(0, VanCarStatusSignals::GetFuelFlapOpen(golden));
+    CHECK_EQUAL(1, VanCarStatusSignals::GetTripButton(golden));
+    CHECK_EQUAL(56, VanCarStatusSignals::GetTrip1Speed(golden));
+    CHECK_EQUAL(0, VanCarStatusSignals::GetTrip2Speed(golden));
+    CHECK_EQUAL(1234, VanCarStatusSignals::GetTrip1Distance(golden));
+    CHECK_EQUAL(65, VanCarStatusSignals::GetTrip1FuelConsumption(golden));
+    CHECK_EQUAL(0x4321, VanCarStatusSignals::GetTrip2Distance(golden));
+    CHECK_EQUAL(0x0102, VanCarStatusSignals::GetTrip2FuelConsumption(golden));
+    CHECK_EQUAL(72, VanCarStatusSignals::GetFuelConsumption(golden));
+    CHECK_EQUAL(380, VanCarStatusSignals::GetFuelLeftToPumpInKm(golden));
+
+    // the header and the footer are not signals
+    uint8_t encoded[VanCarStatusSignals::LENGTH] = { 0 };
+    encoded[0] = 0x0E;
+    encoded[26] = 0x8E;
+    VanCarStatusSignals::SetFrontLeftDoorOpen(encoded, 1);
+    VanCarStatusSignals::SetBootLidOpen(encoded, 1);
+    VanCarStatusSignals::SetTripButton(encoded, 1);
+    VanCarStatusSignals::SetTrip1Speed(encoded, 56);
+    VanCarStatusSignals::SetTrip1Distance(encoded, 1234);
+    VanCarStatusSignals::SetTrip1FuelConsumption(encoded, 65);
+    VanCarStatusSignals::SetTrip2Distance(encoded, 0x4321);
+    VanCarStatusSignals::SetTrip2FuelConsumption(encoded, 0x0102);
+    VanCarStatusSignals::SetFuelConsumption(encoded, 72);
+    VanCarStatusSignals::SetFuelLeftToPumpInKm(encoded, 380);
+    CHECK(memcmp(golden, encoded, sizeof(golden)) == 0);
+}
+
+static void TestVanAirConditioner()
+{
+    // A/C requested with recycling, fan speed byte 0x0B
+    const uint8_t golden1[VanAirConditioner1Signals::LENGTH] = { 0x14, 0x00, 0x00, 0x00, 0x0B };
+
+    CHECK_EQUAL(1, VanAirConditioner1Signals::GetRecyclingOn(golden1));
+    CHECK_EQUAL(1, VanAirConditioner1Signals::GetAirConRequested(golden1));
+    CHECK_EQUAL(0x0B, VanAirConditioner1Signals::GetFanSpeed(golden1));
+
+    uint8_t encoded1[VanAirConditioner1Signals::LENGTH] = { 0 };
+    VanAirConditioner1Signals::SetRecyclingOn(encoded1, 1);
+    VanAirConditioner1Signals::SetAirConRequested(encoded1, 1);
+    VanAirConditioner1Signals::SetFanSpeed(encoded1, 0x0B);
+    CHECK(memcmp(golden1, encoded1, sizeof(golden1)) == 0);
+
+    // powered, A/C on with the compressor running, pressure byte 0x64, evaporator 650 / 10 - 40 C;
+    // the temperature starts at byte 4 as the packed struct put it there, byte 3 is not read
+    const uint8_t golden2[VanAirConditioner2Signals::LENGTH] = { 0xC1, 0x00, 0x64, 0x00, 0x02, 0x8A, 0x00 };
+
+    CHECK_EQUAL(1, VanAirConditioner2Signals::GetCompressorRunning(golden2));
+    CHECK_EQUAL(0, VanAirConditioner2Signals::GetRearWindowHeatingOn(golden2));
+    CHECK_EQUAL(1, VanAirConditioner2Signals::GetAirConOn(golden2));
+    CHECK_EQUAL(1, VanAirConditioner2Signals::GetPowerOn(golden2));
+    CHECK_EQUAL(0x64, VanAirConditioner2Signals::GetPressure(golden2));
+    CHECK_EQUAL(25, VanAirConditioner2Signals::GetEvaporatorTemperature(golden2));
+
+    uint8_t encoded2[VanAirConditioner2Signals::LENGTH] = { 0 };
+    VanAirConditioner2Signals::SetCompressorRunning(encoded2, 1);
+    VanAirConditioner2Signals::SetAirConOn(encoded2, 1);
+    VanAirConditioner2Signals::SetPowerOn(encoded2, 1);
+    VanAirConditioner2Signals::SetPressure(encoded2, 0x64);
+    VanAirConditioner2Signals::SetEvaporatorTemperature(encoded2, 25);
+    CHECK(memcmp(golden2, encoded2, sizeof(golden2)) == 0);
+
+    // below zero
+    VanAirConditioner2Signals::SetEvaporatorTemperature(encoded2, -12);
+    CHECK_EQUAL(280, VanAirConditioner2Signals::GetEvaporatorTemperatureRaw(encoded2));
+    CHECK_EQUAL(-12, VanAirConditioner2Signals::GetEvaporatorTemperature(encoded2));
+}
+
+static void TestVanParkingAidDiagDistance()
+{
+    uint8_t golden[VanParkingAidDiagDistanceSignals::LENGTH] = { 0x0A, 0x61, 0xA0, 0x23, 0x50, 0xFF, 0x41 };
+    golden[VanParkingAidDiagDistanceSignals::LENGTH - 1] = 0x8A;
+
+    CHECK_EQUAL(0xA0, VanParkingAidDiagDistanceSignals::GetDiagFunctionId(golden));
+    CHECK_EQUAL(35, VanParkingAidDiagDistanceSignals::GetExteriorRearLeftDistanceInCm(golden));
+    CHECK_EQUAL(80, VanParkingAidDiagDistanceSignals::GetExteriorRearRightDistanceInCm(golden));
+    CHECK_EQUAL(255, VanParkingAidDiagDistanceSignals::GetInteriorRearLeftDistanceInCm(golden));
+    CHECK_EQUAL(65, VanParkingAidDiagDistanceSignals::GetInteriorRearRightDistanceInCm(golden));
+}
+
+static void TestCanDisplayPopup()
+{
+    // door popup of category 1 with the front left door and the boot open, 1000 km
+    const uint8_t golden[CanDisplayPopupSignals::LENGTH] = { 0x80, 0x0B, 0x80, 0x48, 0x00, 0x00, 0x03, 0xE8 };
+
+    uint8_t encoded[CanDisplayPopupSignals::LENGTH] = { 0 };
+    CanDisplayPopupSignals::SetCategory(encoded, 0x80);
+    CanDisplayPopupSignals::SetMessageType(encoded, 0x0B);
+    CanDisplayPopupSignals::SetShowPopup(encoded, 1);
+    CanDisplayPopupSignals::SetDoorStatus1(encoded, 0x48);
+    CanDisplayPopupSignals::SetKm(encoded, 1000);
+    CHECK(memcmp(golden, encoded, sizeof(golden)) == 0);
+
+    CHECK_EQUAL(0x80, CanDisplayPopupSignals::GetCategory(golden));
+    CHECK_EQUAL(0x0B, CanDisplayPopupSignals::GetMessageType(golden));
+    CHECK_EQUAL(1, CanDisplayPopupSignals::GetShowPopup(golden));
+    CHECK_EQUAL(0x48, CanDisplayPopupSignals::GetDoorStatus1(golden));
+    CHECK_EQUAL(0, CanDisplayPopupSignals::GetDoorStatus2(golden));
+    CHECK_EQUAL(1000, CanDisplayPopupSignals::GetKm(golden));
+}
+
+static void TestCanAirConOnDisplay()
+{
+    // auto mode with recycling, windshield, 21 C left, 22 C right, air to the front, fan speed 4 (sent as 3)
+    const uint8_t golden[CanAirConOnDisplaySignals::LENGTH] = { 0x8A, 0x80, 0x11, 0x12, 0x30, 0x30, 0x03 };
+
+    uint8_t encoded[CanAirConOnDisplaySignals::LENGTH] = { 0 };
+    CanAirConOnDisplaySignals::SetAutoMode(encoded, 1);
+    CanAirConOnDisplaySignals::SetCabinAirRecycling(encoded, 1);
+    CanAirConOnDisplaySignals::SetOutsideAir(encoded, 1);
+    CanAirConOnDisplaySignals::SetWindshield(encoded, 1);
+    CanAirConOnDisplaySignals::SetTemperatureLeft(encoded, 0x11);
+    CanAirConOnDisplaySignals::SetTemperatureRight(encoded, 0x12);
+    CanAirConOnDisplaySignals::SetAirDirectionLeft(encoded, 0x30);
+    CanAirConOnDisplaySignals::SetAirDirectionRight(encoded, 0x30);
+    CanAirConOnDisplaySignals::SetFanSpeed(encoded, 3);
+    CHECK(memcmp(golden, encoded, sizeof(golden)) == 0);
+
+    CHECK_EQUAL(0, CanAirConOnDisplaySignals::GetSeparateSides(golden));
+    CHECK_EQUAL(1, CanAirConOnDisplaySignals::GetAutoMode(golden));
+    CHECK_EQUAL(0, CanAirConOnDisplaySignals::GetOff(golden));
+    CHECK_EQUAL(0, CanAirConOnDisplaySignals::GetAirConOff(golden));
+    CHECK_EQUAL(1, CanAirConOnDisplaySignals::GetWindshield(golden));
+    CHECK_EQUAL(0x12, CanAirConOnDisplaySignals::GetTemperatureRight(golden));
+    CHECK_EQUAL(3, CanAirConOnDisplaySignals::GetFanSpeed(golden));
+}
+
+static void TestCanParkingAid()
+{
+    // sound on the front channel of both speakers, beep period 4, rear 3, rear left 2, rear right 3,
+    // nothing in the front (7), shown on the display
+    const uint8_t golden[CanParkingAidSignals::LENGTH] = { 0x00, 0xF0, 0x04, 0x4C, 0x7C, 0xFE, 0x00, 0x00 };
+
+    uint8_t encoded[CanParkingAidSignals::LENGTH] = { 0 };
+    CanParkingAidSignals::SetSoundEnabled(encoded, 1);
+    CanParkingAidSignals::SetFrontChannel(encoded, 1);
+    CanParkingAidSignals::SetLeftChannelSound(encoded, 1);
+    CanParkingAidSignals::SetRightChannelSound(encoded, 1);
+    CanParkingAidSignals::SetBeepPeriod(encoded, 4);
+    CanParkingAidSignals::SetRear(encoded, 3);
+    CanParkingAidSignals::SetRearLeft(encoded, 2);
+    CanParkingAidSignals::SetFrontLeft(encoded, 7);
+    CanParkingAidSignals::SetRearRight(encoded, 3);
+    CanParkingAidSignals::SetShow(encoded, 1);
+    CanParkingAidSignals::SetFrontRight(encoded, 7);
+    CanParkingAidSignals::SetFront(encoded, 7);
+    CHECK(memcmp(golden, encoded, sizeof(golden)) == 0);
+
+    CHECK_EQUAL(4, CanParkingAidSignals::GetBeepPeriod(golden));
+    CHECK_EQUAL(3, CanParkingAidSignals::GetRear(golden));
+    CHECK_EQUAL(2, CanParkingAidSignals::GetRearLeft(golden));
+    CHECK_EQUAL(3, CanParkingAidSignals::GetRearRight(golden));
+    CHECK_EQUAL(7, CanParkingAidSignals::GetFrontLeft(golden));
+    CHECK_EQUAL(1, CanParkingAidSignals::GetShow(golden));
+
+    // the 3 bit fields of a byte do not overwrite each other
+    CanParkingAidSignals::SetRear(encoded, 0);
+    CHECK_EQUAL(0x40, encoded[3]);
+}
+
+int main()
+{
+    TestVanSpeedAndRpm();
+    TestVanDashboard();
+    TestCanSpeedAndRpm();
+    TestCanTrip0();
+    TestVanCarStatus();
+    TestVanAirConditioner();
+    TestVanParkingAidDiagDistance();
+    TestCanDisplayPopup();
+    TestCanAirConOnDisplay();
+    TestCanParkingAid();
+    return TestResult();
+}
@@ -0,0 +1,46 @@
+// TestCheck.h
+#pragma once
+
+#ifndef _TestCheck_h
+    #define _TestCheck_h
+
+#include <stdio.h>
+
+/*
+    The few macros the host tests need. A failed check is printed with its line and the test goes on,
+    main() returns TestResult() so ctest sees the failure.
+*/
+static int testFailureCount = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) \
+        { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            testFailureCount++; \
+        } \
+    } while (0)
+
+#define CHECK_EQUAL(expected, actual) \
+    do { \
+        const long long expectedValue = (long long)(expected); \
+        const long long actualValue = (long long)(actual); \
+        if (expectedValue != actualValue) \
+        { \
+            printf("%s:%d: CHECK_EQUAL(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, #expected, #actual, expectedValue, actualValue); \
+            testFailureCount++; \
+        } \
+    } while (0)
+
+static int TestResult()
+{
+    if (testFailureCount > 0)
+    {
+        printf("%d check(s) failed\n", testFailureCount);
+        return 1;
+    }
+    printf("passed\n");
+    return 0;
+}
+
+#endif
@@ -0,0 +1,118 @@
+// VanCrc15Test.cpp
+// Checks the table driven CRC-15 against a captured frame and a bitwise reference, and prints how fast both are.
+
+#include <chrono>
+#include <stdlib.h>
+#include <string.h>
+
+#include "TestCheck.h"
+#include "Van/VanCrc15.h"
+
+/*
+    A head unit frame (ident 0x4D4, command nibble 0xE) as logged from a car by the VanBus Arduino library:
+    "0E 4D4 RA0 82-0C-01-00-11-00-3F-3F-3F-3F-82:7B-A4 ACK OK 7BA4 CRC_OK". The receiver puts the SOF byte 0x0E in front.
+*/
+static const uint8_t CAPTURED_FRAME[] = { 0x0E, 0x4D, 0x4E, 0x82, 0x0C, 0x01, 0x00, 0x11, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x82, 0x7B, 0xA4 };
+
+/* Straight from the definition: x^15 + x^11 + x^10 + x^9 + x^8 + x^7 + x^4 + x^3 + x^2 + 1, all ones preset, inverted */
+static uint16_t ReferenceCrc15(const uint8_t data[], size_t length)
+{
+    uint16_t crc = 0x7FFF;
+    for (size_t i = 0; i < length; i++)
+    {
+        for (int bit = 7; bit >= 0; bit--)
+        {
+            const bool feedback = ((crc >> 14) ^ (data[i] >> bit)) & 1;
+            crc = (crc << 1) & 0x7FFF;
+            if (feedback)
+            {
+                crc ^= 0x0F9D;
+            }
+        }
+    }
+    return (crc ^ 0x7FFF) << 1;
+}
+
+static void TestCapturedFrame()
+{
+    CHECK(VanCrc15::IsFrameCrcOk(CAPTURED_FRAME, sizeof(CAPTURED_FRAME)));
+    CHECK_EQUAL(0x7BA4, VanCrc15::Compute(CAPTURED_FRAME + 1, sizeof(CAPTURED_FRAME) - 3));
+    CHECK_EQUAL(0x7BA4, ReferenceCrc15(CAPTURED_FRAME + 1, sizeof(CAPTURED_FRAME) - 3));
+
+    // every single bit error is detected
+    for (size_t i = 1; i < sizeof(CAPTURED_FRAME); i++)
+    {
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            uint8_t frame[sizeof(CAPTURED_FRAME)];
+            memcpy(frame, CAPTURED_FRAME, sizeof(frame));
+            frame[i] ^= 1 << bit;
+            // the last bit of the CRC field is always 0 and not part of the CRC
+            if (i == sizeof(frame) - 1 && bit == 0)
+            {
+                continue;
+            }
+            CHECK(!VanCrc15::IsFrameCrcOk(frame, sizeof(frame)));
+        }
+    }
+
+    CHECK(!VanCrc15::IsFrameCrcOk(CAPTURED_FRAME, 2));
+}
+
+static void TestAgainstReference()
+{
+    srand(15);
+    uint8_t data[32];
+    for (int round = 0; round < 20000; round++)
+    {
+        const uint8_t length = rand() % (sizeof(data) + 1);
+        for (uint8_t i = 0; i < length; i++)
+        {
+            data[i] = rand();
+        }
+
+        const uint16_t expected = ReferenceCrc15(data, length);
+        CHECK_EQUAL(expected, VanCrc15::Compute(data, length));
+
+        // a decoder feeding single bits gets the same result
+        VanCrc15 bitwise;
+        for (uint8_t i = 0; i < length; i++)
+        {
+            for (int bit = 7; bit >= 0; bit--)
+            {
+                bitwise.UpdateBit((data[i] >> bit) & 1);
+            }
+        }
+        CHECK_EQUAL(expected, bitwise.GetCrc());
+    }
+}
+
+static void Benchmark()
+{
+    const size_t FRAME_COUNT = 200000;
+    uint32_t checksum = 0;
+
+    const auto tableStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < FRAME_COUNT; i++)
+    {
+        checksum += VanCrc15::Compute(CAPTURED_FRAME + 1, sizeof(CAPTURED_FRAME) - 3 - (i & 1));
+    }
+    const auto tableEnd = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < FRAME_COUNT; i++)
+    {
+        checksum += ReferenceCrc15(CAPTURED_FRAME + 1, sizeof(CAPTURED_FRAME) - 3 - (i & 1));
+    }
+    const auto referenceEnd = std::chrono::steady_clock::now();
+
+    const double tableTime = std::chrono::duration<double, std::nano>(tableEnd - tableStart).count() / FRAME_COUNT;
+    const double referenceTime = std::chrono::duration<double, std::nano>(referenceEnd - tableEnd).count() / FRAME_COUNT;
+    printf("ns per 13 byte frame: table %.1f, bitwise %.1f (%u)\n", tableTime, referenceTime, (unsigned)(checksum & 1));
+}
+
+int main()
+{
+    TestCapturedFrame();
+    TestAgainstReference();
+    Benchmark();
+    return TestResult();
+}
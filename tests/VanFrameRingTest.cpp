@@ -0,0 +1,173 @@
+// VanFrameRingTest.cpp
+// Fills, drains and wraps the frame ring, then runs a producer and a consumer thread against it.
+
+#include <string.h>
+#include <thread>
+
+#include "TestCheck.h"
+#include "Van/VanFrameRing.h"
+
+static void WriteFrame(VanRawFrame* frame, uint32_t sequence)
+{
+    frame->Timestamp = sequence;
+    frame->Length = 4 + sequence % (VAN_RAW_FRAME_MAX_LENGTH - 4);
+    memcpy(frame->Data, &sequence, sizeof(sequence));
+    for (uint8_t i = 4; i < frame->Length; i++)
+    {
+        frame->Data[i] = (uint8_t)(sequence + i);
+    }
+}
+
+static bool IsFrameOk(const VanRawFrame* frame, uint32_t sequence)
+{
+    uint32_t sequenceInFrame;
+    memcpy(&sequenceInFrame, frame->Data, sizeof(sequenceInFrame));
+    if (sequenceInFrame != sequence || frame->Timestamp != sequence || frame->Length != 4 + sequence % (VAN_RAW_FRAME_MAX_LENGTH - 4))
+    {
+        return false;
+    }
+    for (uint8_t i = 4; i < frame->Length; i++)
+    {
+        if (frame->Data[i] != (uint8_t)(sequence + i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void TestEmpty()
+{
+    VanFrameRing ring;
+    CHECK(ring.Peek() == nullptr);
+    CHECK_EQUAL(0, ring.GetCount());
+    CHECK_EQUAL(0, ring.GetDroppedCount());
+}
+
+static void TestFullAndDrop()
+{
+    VanFrameRing ring;
+
+    for (uint32_t i = 0; i < VanFrameRing::CAPACITY; i++)
+    {
+        VanRawFrame* frame = ring.GetWriteSlot();
+        CHECK(frame != nullptr);
+        WriteFrame(frame, i);
+        ring.Commit();
+    }
+    CHECK_EQUAL(VanFrameRing::CAPACITY, ring.GetCount());
+    CHECK_EQUAL(VanFrameRing::CAPACITY, ring.GetHighWaterMark());
+
+    // the receiver task counts the frame it couldn't store
+    CHECK(ring.GetWriteSlot() == nullptr);
+    ring.CountDropped();
+    CHECK_EQUAL(1, ring.GetDroppedCount());
+
+    // freeing one slot makes room for exactly one frame
+    CHECK(IsFrameOk(ring.Peek(), 0));
+    ring.Release();
+    VanRawFrame* frame = ring.GetWriteSlot();
+    CHECK(frame != nullptr);
+    WriteFrame(frame, VanFrameRing::CAPACITY);
+    ring.Commit();
+    CHECK(ring.GetWriteSlot() == nullptr);
+
+    for (uint32_t i = 1; i <= VanFrameRing::CAPACITY; i++)
+    {
+        CHECK(IsFrameOk(ring.Peek(), i));
+        ring.Release();
+    }
+    CHECK(ring.Peek() == nullptr);
+    CHECK_EQUAL(0, ring.GetCount());
+}
+
+/* The 8 bit head and tail wrap around many times, frames must keep their order across the wrap */
+static void TestWrapAround()
+{
+    VanFrameRing ring;
+    uint32_t written = 0;
+    uint32_t read = 0;
+
+    for (uint32_t round = 0; round < 1000; round++)
+    {
+        const uint32_t writeCount = 1 + round % VanFrameRing::CAPACITY;
+        for (uint32_t i = 0; i < writeCount; i++)
+        {
+            VanRawFrame* frame = ring.GetWriteSlot();
+            if (frame == nullptr)
+            {
+                break;
+            }
+            WriteFrame(frame, written++);
+            ring.Commit();
+        }
+
+        const uint32_t readCount = 1 + (round * 7) % VanFrameRing::CAPACITY;
+        for (uint32_t i = 0; i < readCount; i++)
+        {
+            VanRawFrame* frame = ring.Peek();
+            if (frame == nullptr)
+            {
+                break;
+            }
+            CHECK(IsFrameOk(frame, read));
+            read++;
+            ring.Release();
+        }
+        CHECK_EQUAL(written - read, ring.GetCount());
+    }
+    CHECK(written > 10 * 256);
+}
+
+/* The receiver and the parser task run on different cores, here they are two threads */
+static void TestProducerConsumerThreads()
+{
+    const uint32_t FRAME_COUNT = 500000;
+    static VanFrameRing ring;
+    uint32_t errorCount = 0;
+
+    std::thread consumer([&]() {
+        for (uint32_t sequence = 0; sequence < FRAME_COUNT;)
+        {
+            VanRawFrame* frame = ring.Peek();
+            if (frame == nullptr)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            if (!IsFrameOk(frame, sequence))
+            {
+                errorCount++;
+            }
+            ring.Release();
+            sequence++;
+        }
+    });
+
+    for (uint32_t sequence = 0; sequence < FRAME_COUNT;)
+    {
+        VanRawFrame* frame = ring.GetWriteSlot();
+        if (frame == nullptr)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        WriteFrame(frame, sequence);
+        ring.Commit();
+        sequence++;
+    }
+
+    consumer.join();
+    CHECK_EQUAL(0, errorCount);
+    CHECK(ring.Peek() == nullptr);
+    CHECK(ring.GetHighWaterMark() <= VanFrameRing::CAPACITY);
+}
+
+int main()
+{
+    TestEmpty();
+    TestFullAndDrop();
+    TestWrapAround();
+    TestProducerConsumerThreads();
+    return TestResult();
+}
@@ -0,0 +1,88 @@
+// VanHandlerRegistryTest.cpp
+// The container dispatches with a switch over the positions of the handler list, the handlers sharing an ident are
+// chained at compile time. Checks the positions, the chains and the order the handlers are constructed in.
+
+#include "Arduino.h"
+#include "TestCheck.h"
+#include "Van/Handlers/AbstractVanMessageHandler.h"
+#include "Van/VanHandlerRegistry.h"
+
+static uint8_t constructedCount = 0;
+
+template <uint16_t Ident, uint8_t Length>
+class TestHandler : public AbstractVanMessageHandler {
+public:
+    const static uint16_t IDENT = Ident;
+    const static uint8_t LENGTH = Length;
+
+    uint8_t ConstructedAs;
+
+    TestHandler(VanHandlerContext& context)
+    {
+        (void)context;
+        ConstructedAs = constructedCount++;
+    }
+};
+
+typedef TestHandler<0x4D4, 16> DisplayV2;
+typedef TestHandler<0x524, 8> AnyLength;
+typedef TestHandler<0x4D4, 14> DisplayV1;
+typedef TestHandler<VAN_IDENT_ANY, VAN_LENGTH_ANY> EveryFrame;
+typedef TestHandler<0xADC, 22> DiagSensor;
+typedef TestHandler<0xADC, 12> DiagActuator;
+typedef TestHandler<0x4D4, 4> DisplayShort;
+
+typedef VanHandlerRegistry<DisplayV2, AnyLength, DisplayV1, EveryFrame, DiagSensor, DiagActuator, DisplayShort> Handlers;
+
+static_assert(Handlers::COUNT == 7, "one position per handler");
+
+// the chains of the shared idents follow the order of the list
+static_assert(VanHandlerFindIdent<Handlers, 0x4D4, 0>::VALUE == 0, "first display handler");
+static_assert(VanHandlerNextWithSameIdent<Handlers, 0>::VALUE == 2, "V2 is followed by V1");
+static_assert(VanHandlerNextWithSameIdent<Handlers, 2>::VALUE == 6, "V1 is followed by the short display frame");
+static_assert(VanHandlerNextWithSameIdent<Handlers, 6>::VALUE == Handlers::NO_HANDLER, "the chain ends at the last display handler");
+static_assert(VanHandlerNextWithSameIdent<Handlers, 4>::VALUE == 5, "the diagnostic answers share their ident");
+static_assert(VanHandlerNextWithSameIdent<Handlers, 1>::VALUE == Handlers::NO_HANDLER, "an ident of a single handler has no chain");
+
+static_assert(VanHandlerFindIdent<Handlers, VAN_IDENT_ANY, 0>::VALUE == 3, "the handler of every frame is found");
+static_assert(VanHandlerFindIdent<Handlers, 0x8A4, 0>::VALUE == Handlers::NO_HANDLER, "an ident without a handler");
+
+void TestConstructionOrder()
+{
+    BridgeEventQueue events;
+    SignalBus signals;
+    VanHandlerContext context(&events, &signals);
+    constructedCount = 0;
+
+    Handlers handlers(context);
+
+    CHECK_EQUAL(0, handlers.Get<0>().ConstructedAs);
+    CHECK_EQUAL(3, handlers.Get<3>().ConstructedAs);
+    CHECK_EQUAL(6, handlers.Get<6>().ConstructedAs);
+}
+
+void TestSlots()
+{
+    BridgeEventQueue events;
+    SignalBus signals;
+    VanHandlerContext context(&events, &signals);
+    Handlers handlers(context);
+
+    VanHandlerSlot slots[Handlers::COUNT];
+    handlers.GetSlots(slots);
+
+    CHECK_EQUAL(0x4D4, slots[0].Ident);
+    CHECK_EQUAL(16, slots[0].Length);
+    CHECK_EQUAL(VAN_IDENT_ANY, slots[3].Ident);
+    CHECK_EQUAL(VAN_LENGTH_ANY, slots[3].Length);
+    CHECK_EQUAL(0xADC, slots[5].Ident);
+    CHECK_EQUAL(12, slots[5].Length);
+    CHECK(!slots[5].ProcessUnchangedPayload);
+}
+
+int main()
+{
+    TestConstructionOrder();
+    TestSlots();
+    return TestResult();
+}
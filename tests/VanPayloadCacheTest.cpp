@@ -0,0 +1,137 @@
+// VanPayloadCacheTest.cpp
+// Replays frames through the unchanged payload cache of a handler, in the order VanHandlerContainer calls it:
+// IsUnchanged() for every frame, Store() after the handler processed a changed one.
+
+#include <string.h>
+
+#include "TestCheck.h"
+#include "Van/VanPayloadCache.h"
+
+static const uint8_t CAPTURED_FRAME[] = { 0x0E, 0x4D, 0x4E, 0x82, 0x0C, 0x01, 0x00, 0x11, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x82, 0x7B, 0xA4 };
+
+static const unsigned long SECOND = 1000000;
+
+/* The same hash the cache uses, to find two payloads it can only tell apart by comparing the bytes */
+static uint16_t GetHash(const uint8_t data[], uint8_t dataLength)
+{
+    uint32_t result = 2166136261UL;
+    for (uint8_t i = 0; i < dataLength; i++)
+    {
+        result = (result ^ data[i]) * 16777619UL;
+    }
+    return (uint16_t)(result ^ (result >> 16));
+}
+
+static void TestFrameView()
+{
+    const VanFrameView frame = VanFrameView::FromRawFrame(CAPTURED_FRAME, sizeof(CAPTURED_FRAME), 1234);
+    CHECK(frame.IsValid());
+    CHECK_EQUAL(0x4D4, frame.GetIdent());
+    CHECK_EQUAL(11, frame.GetLength());
+    CHECK_EQUAL(0x82, frame.GetByte(0));
+    CHECK_EQUAL(0x82, frame.GetByte(10));
+    CHECK_EQUAL(0, frame.GetByte(11));
+    CHECK_EQUAL(1234, frame.GetTimestamp());
+
+    CHECK(!VanFrameView::FromRawFrame(CAPTURED_FRAME, 4, 0).IsValid());
+    CHECK(!VanFrameView::FromRawFrame(CAPTURED_FRAME + 1, sizeof(CAPTURED_FRAME) - 1, 0).IsValid());
+}
+
+static void TestUnchangedPayload()
+{
+    VanPayloadCache cache;
+    uint8_t payload[] = { 0x82, 0x0C, 0x01, 0x00, 0x11 };
+    bool result = false;
+
+    const VanFrameView first(payload, sizeof(payload), 0x4D4, 0);
+    CHECK(!cache.IsUnchanged(first, result));
+    cache.Store(first, true);
+
+    // the same bytes again: the handler is skipped and its last result is reused
+    result = false;
+    CHECK(cache.IsUnchanged(VanFrameView(payload, sizeof(payload), 0x4D4, 100000), result));
+    CHECK(result);
+
+    // one changed byte is processed, and the changed payload is not cached until the handler stored it
+    payload[4] = 0x12;
+    CHECK(!cache.IsUnchanged(VanFrameView(payload, sizeof(payload), 0x4D4, 200000), result));
+    payload[4] = 0x11;
+    CHECK(!cache.IsUnchanged(VanFrameView(payload, sizeof(payload), 0x4D4, 300000), result));
+    cache.Store(VanFrameView(payload, sizeof(payload), 0x4D4, 300000), false);
+    CHECK(cache.IsUnchanged(VanFrameView(payload, sizeof(payload), 0x4D4, 400000), result));
+    CHECK(!result);
+
+    // a shorter frame with the same first bytes
+    CHECK(!cache.IsUnchanged(VanFrameView(payload, sizeof(payload) - 1, 0x4D4, 500000), result));
+
+    CHECK_EQUAL(2, cache.GetHitCount());
+    CHECK_EQUAL(4, cache.GetMissCount());
+}
+
+/* An unchanged payload is still processed once a second, also when micros() wraps around */
+static void TestSuppressTime()
+{
+    VanPayloadCache cache;
+    const uint8_t payload[] = { 0x01, 0x02, 0x03 };
+    bool result;
+
+    const unsigned long start = (unsigned long)-SECOND / 2;
+    CHECK(!cache.IsUnchanged(VanFrameView(payload, sizeof(payload), 0x8A4, start), result));
+    cache.Store(VanFrameView(payload, sizeof(payload), 0x8A4, start), true);
+    CHECK(cache.IsUnchanged(VanFrameView(payload, sizeof(payload), 0x8A4, start + SECOND / 2 + 10), result));
+    CHECK(cache.IsUnchanged(VanFrameView(payload, sizeof(payload), 0x8A4, start + SECOND - 1), result));
+    CHECK(!cache.IsUnchanged(VanFrameView(payload, sizeof(payload), 0x8A4, start + SECOND), result));
+}
+
+static void TestHashCollision()
+{
+    // two 2 byte payloads with the same 16 bit hash
+    static uint16_t firstValue[65536];
+    static bool isUsed[65536];
+    uint8_t first[2] = { 0, 0 };
+    uint8_t second[2] = { 0, 0 };
+    bool isFound = false;
+    for (uint32_t value = 0; value < 65536 && !isFound; value++)
+    {
+        const uint8_t data[2] = { (uint8_t)(value >> 8), (uint8_t)value };
+        const uint16_t hash = GetHash(data, 2);
+        if (isUsed[hash])
+        {
+            first[0] = firstValue[hash] >> 8;
+            first[1] = (uint8_t)firstValue[hash];
+            memcpy(second, data, 2);
+            isFound = true;
+        }
+        isUsed[hash] = true;
+        firstValue[hash] = value;
+    }
+    CHECK(isFound);
+
+    VanPayloadCache cache;
+    bool result;
+    CHECK(!cache.IsUnchanged(VanFrameView(first, 2, 0x564, 0), result));
+    cache.Store(VanFrameView(first, 2, 0x564, 0), true);
+    CHECK(cache.IsUnchanged(VanFrameView(first, 2, 0x564, 10), result));
+    CHECK(!cache.IsUnchanged(VanFrameView(second, 2, 0x564, 20), result));
+}
+
+static void TestTooLongPayload()
+{
+    VanPayloadCache cache;
+    uint8_t payload[29] = { 0 };
+    bool result;
+
+    CHECK(!cache.IsUnchanged(VanFrameView(payload, sizeof(payload), 0x564, 0), result));
+    cache.Store(VanFrameView(payload, sizeof(payload), 0x564, 0), true);
+    CHECK(!cache.IsUnchanged(VanFrameView(payload, sizeof(payload), 0x564, 10), result));
+}
+
+int main()
+{
+    TestFrameView();
+    TestUnchangedPayload();
+    TestSuppressTime();
+    TestHashCollision();
+    TestTooLongPayload();
+    return TestResult();
+}
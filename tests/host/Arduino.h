@@ -0,0 +1,58 @@
+// Arduino.h (host stub: the parts of the Arduino core the bridge uses, the time comes from the host clock)
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "binary.h"
+
+#define HEX 16
+#define DEC 10
+#define IRAM_ATTR
+
+typedef uint8_t byte;
+
+/* Milliseconds and microseconds since the program started */
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long milliseconds);
+
+/* Formats like the Arduino Print class, a derived class only writes single bytes */
+class Print {
+    size_t PrintFormatted(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    size_t PrintNumber(unsigned long long value, bool isNegative, int base);
+
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t value) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+
+    size_t print(const char* text);
+    size_t print(char value);
+    size_t print(unsigned char value, int base = DEC) { return PrintNumber(value, false, base); }
+    size_t print(int value, int base = DEC) { return value < 0 && base == DEC ? PrintNumber(-(long long)value, true, base) : PrintNumber((unsigned int)value, false, base); }
+    size_t print(unsigned int value, int base = DEC) { return PrintNumber(value, false, base); }
+    size_t print(long value, int base = DEC) { return value < 0 && base == DEC ? PrintNumber(-(long long)value, true, base) : PrintNumber((unsigned long)value, false, base); }
+    size_t print(unsigned long value, int base = DEC) { return PrintNumber(value, false, base); }
+    size_t print(double value, int digits = 2);
+
+    size_t println();
+    template <class T> size_t println(T value) { const size_t length = print(value); return length + println(); }
+    template <class T> size_t println(T value, int format) { const size_t length = print(value, format); return length + println(); }
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() {}
+};
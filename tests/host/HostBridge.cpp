@@ -0,0 +1,555 @@
+// HostBridge.cpp
+// The bridge on the host: the objects setup() creates, with fakes for the hardware, and the stage loops of the firmware
+// started as threads by TaskProfiler::CreateTasks from a profile table. The fake VAN receiver replays speed, rpm and
+// dashboard frames, the test checks that the CAN frames made from them come out of the transmit queue.
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <stdio.h>
+#include <vector>
+
+#include "Arduino.h"
+#include "HostPlatform.h"
+#include "TestCheck.h"
+
+#include "Config.h"
+#include "SerialPort/AbstractSerial.h"
+#include "Can/AbstractCanMessageSender.h"
+#include "Can/Structs/CanDisplayStructs.h"
+#include "Can/Structs/CanDash1Structs.h"
+#include "Can/Structs/CanIgnitionStructs.h"
+#include "Can/Structs/CanMenuStructs.h"
+#include "Can/Handlers/CanRadioRemoteMessageHandler.h"
+#include "Can/Handlers/CanVinHandler.h"
+#include "Can/Handlers/CanTripInfoHandler.h"
+#include "Can/Handlers/CanStatusOfFunctionsHandler.h"
+#include "Can/Handlers/CanWarningLogHandler.h"
+#include "Can/Handlers/CanSpeedAndRpmHandler.h"
+#include "Can/Handlers/CanDash2MessageHandler.h"
+#include "Can/Handlers/CanDash3MessageHandler.h"
+#include "Can/Handlers/CanDash4MessageHandler.h"
+#include "Can/Handlers/CanParkingAidHandler.h"
+#include "Can/Handlers/CanNaviPositionHandler.h"
+#include "Can/Handlers/CanDisplayPopupHandler3.h"
+#include "Can/Generated/CanSignals.h"
+#include "Can/CanIgnitionTask.h"
+#include "Can/CanDataSenderTask.h"
+#include "Can/CanDataReaderTask.h"
+#include "Can/CanBridgeEventDispatcher.h"
+#include "Can/CanMessageHandlerContainer.h"
+#include "Can/CanHeartbeatScheduler.h"
+#include "Can/CanTransmitQueue.h"
+#include "Can/CanFrameSequencer.h"
+#include "Van/IVanMessageReader.h"
+#include "Van/VanCrc15.h"
+#include "Van/VanDataParserTask.h"
+#include "Van/VanFrameRing.h"
+#include "Van/VanHandlerContainer.h"
+#include "Van/VanReceiverTask.h"
+#include "Van/VanReaderTask.h"
+#include "Van/VanTrafficStatistics.h"
+#include "Van/Generated/VanSignals.h"
+#include "Helpers/BridgeEventQueue.h"
+#include "Helpers/IVinFlashStorage.h"
+#include "Helpers/MemoryReport.h"
+#include "Helpers/DiagnosticCommands.h"
+#include "Helpers/SerialReader.h"
+#include "Helpers/SharedSnapshot.h"
+#include "Helpers/SignalBus.h"
+#include "Helpers/StaticInstance.h"
+#include "Helpers/TaskProfiler.h"
+
+const unsigned long RUN_TIME = 1000;
+// the VAN bus repeats the speed and the dashboard frames about this often
+const unsigned long VAN_FRAME_INTERVAL = 50;
+
+const uint16_t SCRIPTED_SPEED = 87;
+const uint16_t SCRIPTED_RPM = 2350;
+
+#pragma region Fakes
+
+/* Writes to a file, or throws the output away */
+class HostSerialPort : public AbsSer {
+    FILE* _file;
+
+public:
+    HostSerialPort(FILE* file) : _file(file)
+    {
+    }
+
+    void begin(unsigned long, uint8_t) override {}
+    void begin(unsigned long) override {}
+    void end() override {}
+    int available() override { return 0; }
+    int peek() override { return -1; }
+    int read() override { return -1; }
+    int availableForWrite() override { return 64; }
+    void flush() override {}
+
+    size_t write(uint8_t n) override
+    {
+        if (_file != nullptr)
+        {
+            fputc(n, _file);
+        }
+        return 1;
+    }
+
+    size_t write(unsigned long n) override { return write((uint8_t)n); }
+    size_t write(long n) override { return write((uint8_t)n); }
+    size_t write(unsigned int n) override { return write((uint8_t)n); }
+    size_t write(int n) override { return write((uint8_t)n); }
+    operator bool() override { return true; }
+};
+
+/* Keeps the last frame and the number of frames sent per CAN id */
+class HostCanDriver : public AbstractCanMessageSender {
+    struct SentFrames {
+        uint32_t Count = 0;
+        uint8_t Data[8] = { 0 };
+    };
+
+    std::mutex mutex;
+    std::map<uint16_t, SentFrames> sentFrames;
+
+public:
+    void Init() override {}
+
+    uint8_t SendMessage(uint16_t canId, uint8_t ext, uint8_t sizeOfByteArray, uint8_t* byteArray) override
+    {
+        (void)ext;
+        std::lock_guard<std::mutex> lock(mutex);
+        SentFrames& frames = sentFrames[canId];
+        frames.Count++;
+        memcpy(frames.Data, byteArray, sizeOfByteArray < 8 ? sizeOfByteArray : 8);
+        return CAN_SEND_OK;
+    }
+
+    /* Nothing is received, waits like the driver does before it gives up */
+    void ReadMessage(uint16_t* canId, uint8_t* len, uint8_t* buf) override
+    {
+        (void)buf;
+        *canId = 0;
+        *len = 0;
+        delay(10);
+    }
+
+    uint32_t GetSentCount(uint16_t canId, uint8_t data[])
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const SentFrames& frames = sentFrames[canId];
+        memcpy(data, frames.Data, 8);
+        return frames.Count;
+    }
+};
+
+/* Replays the speed and the dashboard frame of a running engine */
+class HostVanReader : public IVanMessageReader {
+    unsigned long nextFrameTime = 0;
+    uint8_t nextFrame = 0;
+    std::atomic<uint32_t> sentCount;
+
+    static uint8_t BuildFrame(uint16_t ident, const uint8_t payload[], uint8_t payloadLength, uint8_t frame[])
+    {
+        frame[0] = 0x0E;
+        frame[1] = ident >> 4;
+        frame[2] = (ident << 4) & 0xF0;
+        memcpy(frame + 3, payload, payloadLength);
+
+        const uint8_t length = 3 + payloadLength;
+        const uint16_t crc = VanCrc15::Compute(frame + 1, length - 1);
+        frame[length] = crc >> 8;
+        frame[length + 1] = crc & 0xFF;
+        return length + 2;
+    }
+
+public:
+    HostVanReader() : sentCount(0)
+    {
+    }
+
+    void Receive(uint8_t* messageLength, uint8_t message[]) override
+    {
+        const unsigned long currentTime = millis();
+        if (currentTime < nextFrameTime)
+        {
+            *messageLength = 0;
+            return;
+        }
+
+        uint8_t payload[VanSpeedAndRpmSignals::LENGTH] = { 0 };
+        if (nextFrame == 0)
+        {
+            VanSpeedAndRpmSignals::SetRpm(payload, SCRIPTED_RPM);
+            VanSpeedAndRpmSignals::SetSpeed(payload, SCRIPTED_SPEED);
+            *messageLength = BuildFrame(VanSpeedAndRpmSignals::IDENT, payload, VanSpeedAndRpmSignals::LENGTH, message);
+            nextFrame = 1;
+        }
+        else
+        {
+            static_assert(VanDashboardSignals::LENGTH <= VanSpeedAndRpmSignals::LENGTH, "the payload buffer is shared");
+            VanDashboardSignals::SetIgnitionOn(payload, 1);
+            VanDashboardSignals::SetEngineRunning(payload, 1);
+            VanDashboardSignals::SetWaterTemperature(payload, 90);
+            VanDashboardSignals::SetExternalTemperature(payload, 21);
+            *messageLength = BuildFrame(VanDashboardSignals::IDENT, payload, VanDashboardSignals::LENGTH, message);
+            nextFrame = 0;
+            nextFrameTime = currentTime + VAN_FRAME_INTERVAL;
+        }
+        sentCount++;
+    }
+
+    void Init() override {}
+    void Stop() override {}
+
+    bool IsCrcOk(uint8_t vanMessage[], uint8_t vanMessageLength) override
+    {
+        return VanCrc15::IsFrameCrcOk(vanMessage, vanMessageLength);
+    }
+
+    uint32_t GetSentCount()
+    {
+        return sentCount;
+    }
+};
+
+class HostVinFlashStorage : public IVinFlashStorage {
+public:
+    void Remove() override {}
+    bool Load() override { return false; }
+    bool Save() override { return true; }
+};
+
+#pragma endregion
+
+const TickType_t VAN_READ_MAX_WAIT = 1000 / portTICK_PERIOD_MS;
+const TickType_t CAN_TRANSMIT_MAX_WAIT = 100 / portTICK_PERIOD_MS;
+const TickType_t CAN_SEQUENCE_WAIT = 1 / portTICK_PERIOD_MS;
+
+SharedSnapshot<VanDataToBridgeToCan> dataToBridgeSnapshot;
+SharedSnapshot<VanIgnitionDataToBridgeToCan> ignitionDataToBridgeSnapshot;
+SharedSnapshot<VanVinToBridgeToCan> vinDataToBridgeSnapshot;
+
+SharedSnapshotView<VanDataToBridgeToCan> sendDataView(dataToBridgeSnapshot);
+SharedSnapshotView<VanIgnitionDataToBridgeToCan> sendIgnitionView(ignitionDataToBridgeSnapshot);
+SharedSnapshotView<VanVinToBridgeToCan> sendIgnitionVinView(vinDataToBridgeSnapshot);
+
+SignalBus signalBus;
+BridgeEventQueue bridgeEventQueue;
+
+// the tasks of the firmware without the VAN write task, it needs the TSS463 controller
+enum TaskIndex {
+    TASK_CAN_TRANSMIT,
+    TASK_CAN_SEND_IGNITION,
+    TASK_CAN_SEND_DATA,
+    TASK_VAN_READ,
+    TASK_VAN_RECEIVE,
+    TASK_CAN_READ,
+    TASK_COUNT
+};
+
+enum HeartbeatLane {
+    HEARTBEAT_LANE_DATA,
+    HEARTBEAT_LANE_IGNITION
+};
+
+TaskProfiler taskProfiler;
+MemoryReport memoryReport(&taskProfiler, MEMORY_REPORT_LOG_INTERVAL);
+
+TaskHandle_t CANTransmitTask;
+TaskHandle_t CANSendIgnitionTask;
+TaskHandle_t CANSendDataTask;
+TaskHandle_t VANReceiveTask;
+TaskHandle_t VANReadTask;
+TaskHandle_t CANReadTask;
+
+// the stage loops run while this is set, the firmware loops forever
+std::atomic<bool> running(true);
+
+HostSerialPort discardedOutput(nullptr);
+HostSerialPort reportOutput(stdout);
+AbsSer* serialPort = &discardedOutput;
+
+HostCanDriver canDriver;
+HostVanReader hostVanReader;
+HostVinFlashStorage hostVinFlashStorage;
+
+CanTransmitQueue* canTransmitQueue;
+CanFrameSequencer canFrameSequencer;
+CanHeartbeatScheduler canHeartbeatScheduler;
+VanFrameRing vanFrameRing;
+VanTrafficStatistics vanTrafficStatistics;
+
+CanIgnitionTask* canIgnitionTask;
+CanDataSenderTask* canDataSenderTask;
+CanDataReaderTask* canDataReaderTask;
+VanReceiverTask* vanReceiverTask;
+VanReaderTask* vanReaderTask;
+
+struct CanObjects {
+    StaticInstance<CanTransmitQueue> TransmitQueue;
+    StaticInstance<CanDisplayPopupHandler3> PopupHandler;
+    StaticInstance<CanVinHandler> VinHandler;
+    StaticInstance<CanTripInfoHandler> TripInfoHandler;
+    StaticInstance<CanRadioRemoteMessageHandler> RadioRemoteMessageHandler;
+    StaticInstance<CanStatusOfFunctionsHandler> StatusOfFunctionsHandler;
+    StaticInstance<CanWarningLogHandler> WarningLogHandler;
+    StaticInstance<CanSpeedAndRpmHandler> SpeedAndRpmHandler;
+    StaticInstance<CanDash2MessageHandler> Dash2MessageHandler;
+    StaticInstance<CanDash3MessageHandler> Dash3MessageHandler;
+    StaticInstance<CanDash4MessageHandler> Dash4MessageHandler;
+    StaticInstance<CanIgnitionPacketSender> RadioIgnition;
+    StaticInstance<CanDashIgnitionPacketSender> DashIgnition;
+    StaticInstance<CanParkingAidHandler> ParkingAid;
+    StaticInstance<CanRadioButtonPacketSender> RadioButtonSender;
+    StaticInstance<CanNaviPositionHandler> NaviPositionHandler;
+    StaticInstance<CanMessageHandlerContainer> MessageHandlerContainer;
+    StaticInstance<CanBridgeEventDispatcher> BridgeEventDispatcher;
+} canObjects;
+
+struct TaskObjects {
+    StaticInstance<VanHandlerContainer> VanHandlers;
+    StaticInstance<CanIgnitionTask> CanIgnition;
+    StaticInstance<CanDataSenderTask> CanDataSender;
+    StaticInstance<CanDataReaderTask> CanDataReader;
+    StaticInstance<VanDataParserTask> VanDataParser;
+    StaticInstance<VanReceiverTask> VanReceiver;
+    StaticInstance<VanReaderTask> VanReader;
+    StaticInstance<DiagnosticCommands> Diagnostics;
+    StaticInstance<SerialReader> SerialCommands;
+} taskObjects;
+
+#pragma region Stages
+
+void CANReadTaskFunction(void* parameter)
+{
+    (void)parameter;
+    while (running)
+    {
+        taskProfiler.BeginCycle(TASK_CAN_READ);
+        const bool messageRead = canDataReaderTask->ReadData();
+        taskProfiler.EndCycle(TASK_CAN_READ);
+
+        if (!messageRead)
+        {
+            vTaskDelay(1 / portTICK_PERIOD_MS);
+        }
+    }
+}
+
+void CANTransmitTaskFunction(void* parameter)
+{
+    (void)parameter;
+    bool isSequenceActive = false;
+
+    canTransmitQueue->SetTransmitTask(xTaskGetCurrentTaskHandle());
+    canFrameSequencer.SetProcessTask(xTaskGetCurrentTaskHandle());
+
+    while (running)
+    {
+        canTransmitQueue->WaitForMessages(isSequenceActive ? CAN_SEQUENCE_WAIT : CAN_TRANSMIT_MAX_WAIT);
+
+        taskProfiler.BeginCycle(TASK_CAN_TRANSMIT);
+        canTransmitQueue->TransmitMessages();
+        isSequenceActive = canFrameSequencer.Process(millis());
+        taskProfiler.EndCycle(TASK_CAN_TRANSMIT);
+    }
+}
+
+// the same as in the firmware
+void WaitForNextCycle(uint8_t lane, TickType_t* previousWakeTime, TickType_t period)
+{
+    unsigned long deadline;
+    for (;;)
+    {
+        canHeartbeatScheduler.Process(lane, millis());
+
+        if (!canHeartbeatScheduler.GetNextDeadline(lane, deadline))
+        {
+            break;
+        }
+
+        const int32_t ticksToCycle = (int32_t)(*previousWakeTime + period - xTaskGetTickCount());
+        const int32_t ticksToDeadline = (int32_t)(deadline - millis()) / (int32_t)portTICK_PERIOD_MS;
+        if (ticksToCycle <= ticksToDeadline)
+        {
+            break;
+        }
+        vTaskDelay(ticksToDeadline > 0 ? ticksToDeadline : 1);
+    }
+
+    vTaskDelayUntil(previousWakeTime, period);
+}
+
+void CANSendDataTaskFunction(void* parameter)
+{
+    (void)parameter;
+    TickType_t previousWakeTime = xTaskGetTickCount();
+
+    while (running)
+    {
+        taskProfiler.BeginCycle(TASK_CAN_SEND_DATA, previousWakeTime);
+        canDataSenderTask->SendData(sendDataView.Take());
+        taskProfiler.EndCycle(TASK_CAN_SEND_DATA);
+
+        WaitForNextCycle(HEARTBEAT_LANE_DATA, &previousWakeTime, taskProfiler.GetPeriod(TASK_CAN_SEND_DATA));
+    }
+}
+
+void CANSendIgnitionTaskFunction(void* parameter)
+{
+    (void)parameter;
+    TickType_t previousWakeTime = xTaskGetTickCount();
+
+    while (running)
+    {
+        taskProfiler.BeginCycle(TASK_CAN_SEND_IGNITION, previousWakeTime);
+        canIgnitionTask->SendIgnition(sendIgnitionView.Take(), sendIgnitionVinView.Take(), millis());
+        taskProfiler.EndCycle(TASK_CAN_SEND_IGNITION);
+
+        WaitForNextCycle(HEARTBEAT_LANE_IGNITION, &previousWakeTime, taskProfiler.GetPeriod(TASK_CAN_SEND_IGNITION));
+    }
+}
+
+void VANReceiveTaskFunction(void* parameter)
+{
+    (void)parameter;
+    while (running)
+    {
+        taskProfiler.BeginCycle(TASK_VAN_RECEIVE);
+        if (vanReceiverTask->ReceiveData() > 0)
+        {
+            taskProfiler.Trigger(TASK_VAN_READ);
+            xTaskNotifyGive(VANReadTask);
+        }
+        taskProfiler.EndCycle(TASK_VAN_RECEIVE);
+
+        vTaskDelay(taskProfiler.GetPeriod(TASK_VAN_RECEIVE));
+    }
+    // the read task may be waiting for a notification
+    xTaskNotifyGive(VANReadTask);
+}
+
+void VANReadTaskFunction(void* parameter)
+{
+    (void)parameter;
+    while (running)
+    {
+        ulTaskNotifyTake(pdTRUE, VAN_READ_MAX_WAIT);
+
+        taskProfiler.BeginCycle(TASK_VAN_READ);
+        vanReaderTask->ReadData(dataToBridgeSnapshot, ignitionDataToBridgeSnapshot, vinDataToBridgeSnapshot);
+        taskProfiler.EndCycle(TASK_VAN_READ);
+    }
+}
+
+#pragma endregion
+
+// the table of the firmware, the host ignores the stack sizes, the priorities and the cores
+const TaskProfile taskProfiles[] = {
+    // name                  function                        stack  priority  core  period  handle
+    { "CANTransmitTask",     CANTransmitTaskFunction,        10000, 3,        0,    0,      &CANTransmitTask },
+    { "CANSendIgnitionTask", CANSendIgnitionTaskFunction,    15000, 2,        0,    40,     &CANSendIgnitionTask },
+    { "CANSendDataTask",     CANSendDataTaskFunction,        15000, 0,        0,    10,     &CANSendDataTask },
+    { "VANReadTask",         VANReadTaskFunction,            20000, 1,        1,    0,      &VANReadTask },
+    { "VANReceiveTask",      VANReceiveTaskFunction,         10000, 2,        1,    1,      &VANReceiveTask },
+    { "CANReadTask",         CANReadTaskFunction,            10000, 0,        1,    0,      &CANReadTask },
+};
+
+static_assert(sizeof(taskProfiles) / sizeof(taskProfiles[0]) == TASK_COUNT, "every task needs a profile");
+
+void Setup()
+{
+    canTransmitQueue = canObjects.TransmitQueue.Create(&canDriver);
+    canTransmitQueue->Init();
+    AbstractCanMessageSender* CANInterface = canTransmitQueue;
+
+    ICanDisplayPopupHandler* canPopupHandler = canObjects.PopupHandler.Create(CANInterface);
+    CanVinHandler* canVinHandler = canObjects.VinHandler.Create(CANInterface);
+    CanTripInfoHandler* tripInfoHandler = canObjects.TripInfoHandler.Create(CANInterface);
+    CanRadioRemoteMessageHandler* canRadioRemoteMessageHandler = canObjects.RadioRemoteMessageHandler.Create(CANInterface);
+    CanStatusOfFunctionsHandler* canStatusOfFunctionsHandler = canObjects.StatusOfFunctionsHandler.Create(CANInterface);
+    CanWarningLogHandler* canWarningLogHandler = canObjects.WarningLogHandler.Create(CANInterface);
+    CanSpeedAndRpmHandler* canSpeedAndRpmHandler = canObjects.SpeedAndRpmHandler.Create(CANInterface);
+    CanDash2MessageHandler* canDash2MessageHandler = canObjects.Dash2MessageHandler.Create(CANInterface);
+    CanDash3MessageHandler* canDash3MessageHandler = canObjects.Dash3MessageHandler.Create(CANInterface);
+    CanDash4MessageHandler* canDash4MessageHandler = canObjects.Dash4MessageHandler.Create(CANInterface);
+    CanIgnitionPacketSender* radioIgnition = canObjects.RadioIgnition.Create(CANInterface);
+    CanDashIgnitionPacketSender* dashIgnition = canObjects.DashIgnition.Create(CANInterface);
+    CanParkingAidHandler* canParkingAid = canObjects.ParkingAid.Create(CANInterface);
+    CanRadioButtonPacketSender* canRadioButtonSender = canObjects.RadioButtonSender.Create(CANInterface);
+    CanNaviPositionHandler* canNaviPositionHandler = canObjects.NaviPositionHandler.Create(CANInterface);
+
+    canHeartbeatScheduler.Register(canSpeedAndRpmHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canDash2MessageHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canDash3MessageHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canDash4MessageHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canRadioRemoteMessageHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canNaviPositionHandler, HEARTBEAT_LANE_DATA);
+    canHeartbeatScheduler.Register(canParkingAid, HEARTBEAT_LANE_IGNITION);
+
+    CanMessageHandlerContainer* canMessageHandlerContainer = canObjects.MessageHandlerContainer.Create(CANInterface, serialPort, &hostVinFlashStorage);
+    CanBridgeEventDispatcher* canBridgeEventDispatcher = canObjects.BridgeEventDispatcher.Create(
+        &bridgeEventQueue,
+        canPopupHandler,
+        tripInfoHandler,
+        canStatusOfFunctionsHandler,
+        canWarningLogHandler,
+        canRadioRemoteMessageHandler);
+
+    VanHandlerContainer* vanHandlerContainer = taskObjects.VanHandlers.Create(&bridgeEventQueue, &signalBus);
+    DiagnosticCommands* diagnosticCommands = taskObjects.Diagnostics.Create(
+        serialPort, &bridgeEventQueue, vanHandlerContainer, &vanTrafficStatistics, &canHeartbeatScheduler, canTransmitQueue, &taskProfiler, &memoryReport);
+    SerialReader* serialReader = taskObjects.SerialCommands.Create(serialPort, CANInterface, &bridgeEventQueue, &hostVinFlashStorage, diagnosticCommands);
+
+    canIgnitionTask = taskObjects.CanIgnition.Create(radioIgnition, dashIgnition, canParkingAid, canPopupHandler, canVinHandler, &bridgeEventQueue, &signalBus);
+    canDataSenderTask = taskObjects.CanDataSender.Create(
+        canSpeedAndRpmHandler, tripInfoHandler, canPopupHandler, canRadioRemoteMessageHandler, canDash2MessageHandler, canDash3MessageHandler,
+        canDash4MessageHandler, canRadioButtonSender, canNaviPositionHandler, canBridgeEventDispatcher, &signalBus);
+    canDataReaderTask = taskObjects.CanDataReader.Create(CANInterface, &bridgeEventQueue, canMessageHandlerContainer, canDataSenderTask);
+    VanDataParserTask* vanDataParserTask = taskObjects.VanDataParser.Create(serialPort, canVinHandler, vanHandlerContainer);
+    vanReceiverTask = taskObjects.VanReceiver.Create(&hostVanReader, serialReader, &vanFrameRing);
+    vanReaderTask = taskObjects.VanReader.Create(&hostVanReader, &vanFrameRing, vanDataParserTask, &vanTrafficStatistics, serialPort);
+
+    canFrameSequencer.Register(tripInfoHandler->GetFrameSequence());
+    canFrameSequencer.Register(canPopupHandler->GetFrameSequence());
+    canFrameSequencer.Register(serialReader->GetFrameSequence());
+}
+
+int main()
+{
+    Setup();
+
+    taskProfiler.CreateTasks(taskProfiles, TASK_COUNT);
+    delay(RUN_TIME);
+    running = false;
+    HostJoinTasks();
+
+    taskProfiler.Print(&reportOutput);
+    canTransmitQueue->Print(&reportOutput);
+    vanTrafficStatistics.Print(&reportOutput, micros());
+    canHeartbeatScheduler.Print(&reportOutput);
+
+    for (uint8_t i = 0; i < TASK_COUNT; i++)
+    {
+        CHECK(taskProfiler.GetStatistics(i).CycleCount > 0);
+    }
+
+    // every frame went through the ring
+    CHECK(hostVanReader.GetSentCount() > 0);
+    CHECK_EQUAL(0, vanFrameRing.GetDroppedCount());
+
+    // the speed and the rpm of the VAN frames are sent on CAN
+    uint8_t data[8];
+    const uint32_t speedAndRpmCount = canDriver.GetSentCount(CanSpeedAndRpmSignals::ID, data);
+    printf("0x%03X sent %u times\n", CanSpeedAndRpmSignals::ID, speedAndRpmCount);
+    CHECK(speedAndRpmCount > 0);
+    CHECK_EQUAL(SCRIPTED_SPEED, CanSpeedAndRpmSignals::GetSpeed(data));
+    CHECK_EQUAL(SCRIPTED_RPM, CanSpeedAndRpmSignals::GetRpm(data));
+
+    // the heartbeat of the parking aid is only sent in reverse
+    CHECK_EQUAL(0, canDriver.GetSentCount(CAN_ID_PARKING_AID, data));
+
+    return TestResult();
+}
@@ -0,0 +1,271 @@
+// HostPlatform.cpp
+// The Arduino and FreeRTOS functions of the host stubs: a task is a std::thread, a tick is a millisecond of the steady
+// clock, task notifications and queues wait on condition variables.
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdarg.h>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "HostPlatform.h"
+
+typedef std::chrono::steady_clock HostClock;
+
+static const HostClock::time_point startTime = HostClock::now();
+
+struct HostTask {
+    const char* Name;
+    std::thread Thread;
+    std::mutex Mutex;
+    std::condition_variable Notified;
+    uint32_t NotifyCount = 0;
+};
+
+struct HostQueue {
+    std::mutex Mutex;
+    std::condition_variable Changed;
+    std::vector<uint8_t> Items;
+    UBaseType_t Length;
+    UBaseType_t ItemSize;
+    UBaseType_t First = 0;
+    UBaseType_t Count = 0;
+};
+
+struct HostMutex {
+    std::timed_mutex Mutex;
+};
+
+static std::mutex tasksMutex;
+static std::vector<HostTask*> tasks;
+static thread_local HostTask* currentTask = nullptr;
+
+static HostClock::time_point GetDeadline(TickType_t maxWait)
+{
+    return maxWait == portMAX_DELAY ? HostClock::time_point::max() : HostClock::now() + std::chrono::milliseconds(maxWait);
+}
+
+#pragma region Arduino
+
+unsigned long millis()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(HostClock::now() - startTime).count();
+}
+
+unsigned long micros()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(HostClock::now() - startTime).count();
+}
+
+void delay(unsigned long milliseconds)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        write(buffer[i]);
+    }
+    return size;
+}
+
+size_t Print::PrintFormatted(const char* format, ...)
+{
+    char buffer[64];
+    va_list arguments;
+    va_start(arguments, format);
+    const int length = vsnprintf(buffer, sizeof(buffer), format, arguments);
+    va_end(arguments);
+    return length > 0 ? write((const uint8_t*)buffer, strlen(buffer)) : 0;
+}
+
+size_t Print::PrintNumber(unsigned long long value, bool isNegative, int base)
+{
+    if (base == HEX)
+    {
+        return PrintFormatted("%llX", value);
+    }
+    return PrintFormatted(isNegative ? "-%llu" : "%llu", value);
+}
+
+size_t Print::print(const char* text)
+{
+    return write((const uint8_t*)text, strlen(text));
+}
+
+size_t Print::print(char value)
+{
+    return write((uint8_t)value);
+}
+
+size_t Print::print(double value, int digits)
+{
+    return PrintFormatted("%.*f", digits, value);
+}
+
+size_t Print::println()
+{
+    return print("\r\n");
+}
+
+#pragma endregion
+
+#pragma region Tasks
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t, void* parameter, UBaseType_t, TaskHandle_t* handle, BaseType_t)
+{
+    HostTask* task = new HostTask();
+    task->Name = name;
+    if (handle != nullptr)
+    {
+        *handle = task;
+    }
+
+    std::lock_guard<std::mutex> lock(tasksMutex);
+    tasks.push_back(task);
+    task->Thread = std::thread([task, function, parameter]() {
+        currentTask = task;
+        function(parameter);
+    });
+    return pdPASS;
+}
+
+void HostJoinTasks()
+{
+    std::vector<HostTask*> createdTasks;
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex);
+        createdTasks.swap(tasks);
+    }
+    for (HostTask* task : createdTasks)
+    {
+        task->Thread.join();
+        delete task;
+    }
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return currentTask;
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return (TickType_t)millis();
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t period)
+{
+    *previousWakeTime += period;
+    std::this_thread::sleep_until(startTime + std::chrono::milliseconds(*previousWakeTime));
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t maxWait)
+{
+    HostTask* task = currentTask;
+    std::unique_lock<std::mutex> lock(task->Mutex);
+    task->Notified.wait_until(lock, GetDeadline(maxWait), [task]() { return task->NotifyCount > 0; });
+
+    const uint32_t count = task->NotifyCount;
+    if (count > 0)
+    {
+        task->NotifyCount = clearCountOnExit ? 0 : count - 1;
+    }
+    return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    {
+        std::lock_guard<std::mutex> lock(task->Mutex);
+        task->NotifyCount++;
+    }
+    task->Notified.notify_one();
+    return pdPASS;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t)
+{
+    return 0;
+}
+
+#pragma endregion
+
+#pragma region Queues
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    HostQueue* queue = new HostQueue();
+    queue->Items.resize(length * itemSize);
+    queue->Length = length;
+    queue->ItemSize = itemSize;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t maxWait)
+{
+    std::unique_lock<std::mutex> lock(queue->Mutex);
+    if (!queue->Changed.wait_until(lock, GetDeadline(maxWait), [queue]() { return queue->Count < queue->Length; }))
+    {
+        return pdFALSE;
+    }
+
+    const UBaseType_t index = (queue->First + queue->Count) % queue->Length;
+    memcpy(&queue->Items[index * queue->ItemSize], item, queue->ItemSize);
+    queue->Count++;
+    queue->Changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t maxWait)
+{
+    std::unique_lock<std::mutex> lock(queue->Mutex);
+    if (!queue->Changed.wait_until(lock, GetDeadline(maxWait), [queue]() { return queue->Count > 0; }))
+    {
+        return pdFALSE;
+    }
+
+    memcpy(item, &queue->Items[queue->First * queue->ItemSize], queue->ItemSize);
+    queue->First = (queue->First + 1) % queue->Length;
+    queue->Count--;
+    queue->Changed.notify_all();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    std::lock_guard<std::mutex> lock(queue->Mutex);
+    return queue->Count;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    return new HostMutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t maxWait)
+{
+    if (maxWait == portMAX_DELAY)
+    {
+        mutex->Mutex.lock();
+        return pdTRUE;
+    }
+    return mutex->Mutex.try_lock_for(std::chrono::milliseconds(maxWait)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex)
+{
+    mutex->Mutex.unlock();
+    return pdTRUE;
+}
+
+#pragma endregion
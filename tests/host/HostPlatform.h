@@ -0,0 +1,10 @@
+// HostPlatform.h
+#pragma once
+
+#ifndef _HostPlatform_h
+    #define _HostPlatform_h
+
+/* Waits until every task created with xTaskCreatePinnedToCore() returned from its function */
+void HostJoinTasks();
+
+#endif
@@ -0,0 +1,8 @@
+// esp_task_wdt.h (host stub: there is no watchdog on the host)
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+inline int esp_task_wdt_init(uint32_t, bool) { return 0; }
+inline int esp_task_wdt_add(TaskHandle_t) { return 0; }
+inline int esp_task_wdt_reset() { return 0; }
@@ -0,0 +1,25 @@
+// FreeRTOS.h (host stub: the tasks, queues and mutexes the bridge uses, implemented with std::thread in HostPlatform.cpp)
+#pragma once
+
+#include <stdint.h>
+
+struct HostTask;
+struct HostQueue;
+struct HostMutex;
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef HostTask* TaskHandle_t;
+typedef HostQueue* QueueHandle_t;
+typedef HostMutex* SemaphoreHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+// one tick is a millisecond, as configured for the ESP32 Arduino core
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY 0xFFFFFFFFUL
+#define pdMS_TO_TICKS(x) (x)
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
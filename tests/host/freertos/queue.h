@@ -0,0 +1,9 @@
+// queue.h (host stub)
+#pragma once
+
+#include "FreeRTOS.h"
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t maxWait);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t maxWait);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
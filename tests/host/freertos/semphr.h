@@ -0,0 +1,8 @@
+// semphr.h (host stub)
+#pragma once
+
+#include "FreeRTOS.h"
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t maxWait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex);
@@ -0,0 +1,15 @@
+// task.h (host stub)
+#pragma once
+
+#include "FreeRTOS.h"
+
+/* Starts a thread, the core and the priority are only recorded, the host scheduler decides */
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackSize, void* parameter, UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+TickType_t xTaskGetTickCount();
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t period);
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t maxWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+/* The stack of a thread is not measured, always 0 */
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
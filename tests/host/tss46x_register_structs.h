@@ -0,0 +1,15 @@
+// tss46x_register_structs.h (host stub)
+// The register type of the TSS463 library which AbstractVanMessageSender returns, the host has no VAN controller.
+#pragma once
+
+#include <stdint.h>
+
+typedef union {
+    struct {
+        uint8_t CHRx : 1;
+        uint8_t CHTx : 1;
+        uint8_t CHER : 1;
+        uint8_t M_L : 5;
+    } data;
+    uint8_t Value;
+} MessageLengthAndStatusRegister;
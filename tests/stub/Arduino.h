@@ -0,0 +1,14 @@
+// Arduino.h (host stub: the tested headers only need the C library, the tests pass the time in explicitly)
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// the binary constants of the Arduino binary.h the packet structs use
+#define B000 0
+#define B001 1
+#define B010 2
+#define B011 3
+#define B100 4
+#define B101 5
+#define B110 6
+#define B111 7
@@ -0,0 +1,268 @@
+"""
+Generates the VAN and CAN signal codecs from schema/signals.json.
+
+Every message in the schema becomes a struct with a BitField descriptor per signal and static
+functions which read and write the signals straight from the payload bytes, so the layout does not
+depend on how the compiler packs bitfields.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and rewrites a header only if
+its content changed. It can also be run by hand:
+
+    python tools/generate_signals.py          regenerates the headers
+    python tools/generate_signals.py --check  fails if a header is out of date
+"""
+
+import json
+import os
+import sys
+
+try:
+    ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+except NameError:
+    # PlatformIO runs extra scripts without __file__
+    Import("env")
+    ROOT_DIR = env.subst("$PROJECT_DIR")
+
+SCHEMA_PATH = os.path.join(ROOT_DIR, "schema", "signals.json")
+
+BUSES = [
+    # schema key, name prefix, ident type, output path
+    ("van", "Van", "IDENT", os.path.join(ROOT_DIR, "PSAVanCanBridge", "src", "Van", "Generated", "VanSignals.h")),
+    ("can", "Can", "ID", os.path.join(ROOT_DIR, "PSAVanCanBridge", "src", "Can", "Generated", "CanSignals.h")),
+]
+
+
+class SchemaError(Exception):
+    pass
+
+
+def parse_int(value):
+    if isinstance(value, str):
+        return int(value, 0)
+    return value
+
+
+def get_unsigned_type(width):
+    for bits in (8, 16, 32):
+        if width <= bits:
+            return "uint%d_t" % bits
+    raise SchemaError("signals wider than 32 bits are not supported")
+
+
+def get_type_for_range(minimum, maximum):
+    if minimum >= 0:
+        for bits in (8, 16, 32):
+            if maximum < (1 << bits):
+                return "uint%d_t" % bits
+    else:
+        for bits in (8, 16, 32):
+            if minimum >= -(1 << (bits - 1)) and maximum < (1 << (bits - 1)):
+                return "int%d_t" % bits
+    raise SchemaError("physical range %d..%d does not fit 32 bits" % (minimum, maximum))
+
+
+class Signal:
+    def __init__(self, message, definition):
+        self.name = definition["name"]
+        self.byte = definition["byte"]
+        self.bit = definition.get("bit", 0)
+        self.width = definition["width"]
+        self.endian = definition.get("endian", "big")
+        self.factor = definition.get("factor", 1)
+        self.divisor = definition.get("divisor", 1)
+        self.offset = definition.get("offset", 0)
+        self.invalid = parse_int(definition["invalid"]) if "invalid" in definition else None
+
+        where = "%s.%s" % (message.name, self.name)
+        if self.endian not in ("big", "little"):
+            raise SchemaError("%s: endian must be big or little" % where)
+        if self.bit + self.width > 8 and (self.bit != 0 or self.width % 8 != 0):
+            raise SchemaError("%s: a signal must fit in one byte or be made of whole bytes" % where)
+        if self.byte + self.byte_count > message.length:
+            raise SchemaError("%s: does not fit in the %d byte payload" % (where, message.length))
+
+        self.raw_type = get_unsigned_type(self.width)
+        raw_maximum = (1 << self.width) - 1
+        limits = [(raw + self.offset) * self.factor // self.divisor for raw in (0, raw_maximum)]
+        self.value_type = get_type_for_range(min(limits), max(limits))
+
+    @property
+    def byte_count(self):
+        return 1 if self.width <= 8 else self.width // 8
+
+    @property
+    def is_scaled(self):
+        return self.factor != 1 or self.divisor != 1 or self.offset != 0 or self.invalid is not None
+
+    def describe(self):
+        if self.byte_count == 1:
+            if self.width == 8:
+                location = "byte %d" % self.byte
+            elif self.width == 1:
+                location = "byte %d bit %d" % (self.byte, self.bit)
+            else:
+                location = "byte %d bits %d-%d" % (self.byte, self.bit, self.bit + self.width - 1)
+        else:
+            location = "bytes %d-%d %s endian" % (self.byte, self.byte + self.byte_count - 1, self.endian)
+
+        if self.is_scaled:
+            value = "raw"
+            if self.offset != 0:
+                value = "(raw %s %d)" % ("-" if self.offset < 0 else "+", abs(self.offset))
+            if self.factor != 1:
+                value += " * %d" % self.factor
+            if self.divisor != 1:
+                value += " / %d" % self.divisor
+            location += ", value = " + value
+            if self.invalid is not None:
+                location += ", raw 0x%X reads as 0" % self.invalid
+        return location
+
+    def emit(self, lines):
+        field_name = self.name + "Field"
+        raw_name = self.name + ("Raw" if self.is_scaled else "")
+
+        if self.byte_count == 1:
+            descriptor = "BitField<%d, %d, %d>" % (self.byte, self.bit, self.width)
+        else:
+            descriptor = "BitField<%d, 0, %d, BIT_FIELD_%s_ENDIAN>" % (self.byte, self.width, self.endian.upper())
+
+        lines.append("    // %s: %s" % (self.name, self.describe()))
+        lines.append("    typedef %s %s;" % (descriptor, field_name))
+        lines.append("")
+
+        lines.append("    static %s Get%s(const uint8_t data[])" % (self.raw_type, raw_name))
+        lines.append("    {")
+        lines.append("        return %s::Get(data);" % field_name)
+        lines.append("    }")
+        lines.append("")
+
+        lines.append("    static void Set%s(uint8_t data[], %s raw)" % (raw_name, self.raw_type))
+        lines.append("    {")
+        lines.append("        %s::Set(data, raw);" % field_name)
+        lines.append("    }")
+        lines.append("")
+
+        if not self.is_scaled:
+            return
+
+        # physical value reader
+        lines.append("    static %s Get%s(const uint8_t data[])" % (self.value_type, self.name))
+        lines.append("    {")
+        lines.append("        const %s raw = Get%s(data);" % (self.raw_type, raw_name))
+        if self.invalid is not None:
+            lines.append("        if (raw == 0x%X)" % self.invalid)
+            lines.append("        {")
+            lines.append("            return 0;")
+            lines.append("        }")
+        value = "raw"
+        if self.offset != 0:
+            value = "((int32_t)raw %s %d)" % ("-" if self.offset < 0 else "+", abs(self.offset))
+        if self.factor != 1:
+            value += " * %d" % self.factor
+        if self.divisor != 1:
+            value += " / %d" % self.divisor
+        lines.append("        return (%s)(%s);" % (self.value_type, value))
+        lines.append("    }")
+        lines.append("")
+
+        # physical value writer
+        lines.append("    static void Set%s(uint8_t data[], %s value)" % (self.name, self.value_type))
+        lines.append("    {")
+        raw = "(int32_t)value"
+        if self.divisor != 1:
+            raw += " * %d" % self.divisor
+        if self.factor != 1:
+            raw += " / %d" % self.factor
+        if self.offset != 0:
+            raw = "%s %s %d" % (raw, "+" if self.offset < 0 else "-", abs(self.offset))
+        lines.append("        Set%s(data, (%s)(%s));" % (raw_name, self.raw_type, raw))
+        lines.append("    }")
+        lines.append("")
+
+
+class Message:
+    def __init__(self, bus_prefix, definition):
+        self.name = definition["name"]
+        self.struct_name = "%s%sSignals" % (bus_prefix, self.name)
+        self.id = parse_int(definition["id"])
+        self.length = definition["length"]
+        self.period = definition.get("period")
+        self.signals = [Signal(self, signal) for signal in definition["signals"]]
+
+    def emit(self, lines, bus_prefix, ident_name):
+        lines.append("// %s 0x%03X" % (bus_prefix.upper(), self.id))
+        lines.append("struct %s {" % self.struct_name)
+        lines.append("    const static uint16_t %s = 0x%03X;" % (ident_name, self.id))
+        lines.append("    const static uint8_t LENGTH = %d;" % self.length)
+        if self.period is not None:
+            lines.append("    // transmit period in milliseconds")
+            lines.append("    const static uint16_t PERIOD = %d;" % self.period)
+        lines.append("")
+        for signal in self.signals:
+            signal.emit(lines)
+        # drop the empty line after the last function
+        lines.pop()
+        lines.append("};")
+        lines.append("")
+
+
+def generate_header(bus_prefix, ident_name, messages, file_name):
+    guard = "_%s_h" % file_name[:-2]
+    lines = [
+        "// %s" % file_name,
+        "// Generated by tools/generate_signals.py from schema/signals.json, do not edit by hand",
+        "#pragma once",
+        "",
+        "#ifndef %s" % guard,
+        "    #define %s" % guard,
+        "",
+        "#include <stdint.h>",
+        "",
+        "#include \"../../Helpers/BitField.h\"",
+        "",
+    ]
+    for message in messages:
+        message.emit(lines, bus_prefix, ident_name)
+    lines.append("#endif")
+    return "\n".join(lines) + "\n"
+
+
+def generate():
+    with open(SCHEMA_PATH) as schema_file:
+        schema = json.load(schema_file)
+
+    outputs = {}
+    for key, bus_prefix, ident_name, path in BUSES:
+        messages = [Message(bus_prefix, definition) for definition in schema.get(key, [])]
+        outputs[path] = generate_header(bus_prefix, ident_name, messages, os.path.basename(path))
+    return outputs
+
+
+def read_file(path):
+    if not os.path.exists(path):
+        return None
+    with open(path, newline="") as existing_file:
+        return existing_file.read().replace("\r\n", "\n")
+
+
+def main(check_only):
+    outdated = []
+    for path, content in generate().items():
+        if read_file(path) == content:
+            continue
+        outdated.append(path)
+        if not check_only:
+            with open(path, "w", newline="\n") as output_file:
+                output_file.write(content)
+
+    for path in outdated:
+        print("%s %s" % ("Out of date:" if check_only else "Generated", os.path.relpath(path, ROOT_DIR)))
+    return 1 if check_only and outdated else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main("--check" in sys.argv[1:]))
+else:
+    # loaded by PlatformIO as an extra script
+    main(False)